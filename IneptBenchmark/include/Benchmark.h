@@ -0,0 +1,166 @@
+#pragma once
+
+#include <IneptEngine.h>
+
+#include <limits>
+
+namespace IneptBenchmark {
+	/**
+	 * @brief Clock used for all benchmark measurements
+	 */
+	using BenchmarkClock = std::chrono::steady_clock;
+
+	/**
+	 * @fn double MeasureNanoseconds(Func&& func)
+	 * @brief Measures how long a single call of the passed function takes.
+	 * @param func The function to measure
+	 * @return The elapsed time in nanoseconds
+	 */
+	template<typename Func>
+	double MeasureNanoseconds(Func&& func) {
+		auto start = BenchmarkClock::now();
+		func();
+		auto end = BenchmarkClock::now();
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+
+	/**
+	 * @fn bool RunDispatchScalingBenchmark()
+	 * @brief Measures EventBus dispatch cost while subscribers to unrelated events are added.
+	 *
+	 * The cost per event should stay flat as the number of unrelated subscribers grows.
+	 *
+	 * @return True if the handler was called once per event
+	 */
+	bool RunDispatchScalingBenchmark();
+
+	/**
+	 * @fn void RunStorageModeBenchmark()
+	 * @brief Compares publishing and processing large event bursts in the polymorphic and contiguous storage modes.
+	 */
+	void RunStorageModeBenchmark();
+
+	/**
+	 * @fn bool RunHandlerOverheadBenchmark()
+	 * @brief Compares the per-handler dispatch cost of std::function + std::bind subscribers with typed Subscribe<T> subscribers.
+	 * @return True if both kinds of subscribers computed the same result
+	 */
+	bool RunHandlerOverheadBenchmark();
+
+	/**
+	 * @fn bool RunSubscriptionSoakBenchmark()
+	 * @brief Subscribes and unsubscribes handlers every frame for a long run.
+	 *
+	 * The subscriber count and the time per frame should stay flat for the whole run.
+	 *
+	 * @return True if the long lived subscriber was called once per frame
+	 */
+	bool RunSubscriptionSoakBenchmark();
+
+	/**
+	 * @fn void RunCoalescingBenchmark()
+	 * @brief Compares processing bursts of mouse events with and without coalescing, and reports how many events were merged.
+	 */
+	void RunCoalescingBenchmark();
+
+	/**
+	 * @fn bool RunConcurrentDispatchBenchmark()
+	 * @brief Compares processing events for heavy handlers on the main thread with running them on the JobSystem.
+	 * @return True if every handler received its events in order and both ways computed the same results
+	 */
+	bool RunConcurrentDispatchBenchmark();
+
+	/**
+	 * @fn void RunStatsOverheadBenchmark()
+	 * @brief Measures the dispatch cost of collecting event stats and logs the collected stats.
+	 */
+	void RunStatsOverheadBenchmark();
+
+	/**
+	 * @fn void RunTimerWheelBenchmark()
+	 * @brief Schedules, advances and cancels timers with a growing number of pending timers.
+	 *
+	 * The cost per schedule, per cancel and per frame should not depend on the number of pending timers, only on how many fire.
+	 */
+	void RunTimerWheelBenchmark();
+
+	/**
+	 * @fn void RunClockBenchmark()
+	 * @brief Compares reading the standard clocks with the engine clock, and measures event construction and timestamp formatting.
+	 */
+	void RunClockBenchmark();
+
+	/**
+	 * @fn void RunEventChannelBenchmark()
+	 * @brief Measures events per second and round-trip latency through a shared memory EventChannel looped back to this process.
+	 */
+	void RunEventChannelBenchmark();
+
+	/**
+	 * @fn void RunFramePacingBenchmark()
+	 * @brief Paces frames to common frame rates and reports how far frame times strayed from the target.
+	 */
+	void RunFramePacingBenchmark();
+
+	/**
+	 * @fn void RunJobSystemBenchmark()
+	 * @brief Runs a compute bound ParallelFor and ParallelReduce with one thread up to one per hardware thread and reports the speedup.
+	 *
+	 * Also reports the cost of submitting and running an empty job, which bounds how small a job is worth making.
+	 */
+	void RunJobSystemBenchmark();
+
+	/**
+	 * @fn bool RunJobSystemStressTest()
+	 * @brief Checks that every item pushed into a WorkStealingDeque and every job submitted to the JobSystem is taken exactly once.
+	 *
+	 * The owner of a deque pushes and pops while thieves steal from it, then jobs submitting more jobs run on every
+	 * worker. Nothing is timed, a lost or duplicated item fails the benchmark run and the --check run.
+	 *
+	 * @return True if every item and job was taken exactly once
+	 */
+	bool RunJobSystemStressTest();
+
+	/**
+	 * @fn void RunRenderPipelineBenchmark()
+	 * @brief Compares the frame time of drawing on the main thread with pipelined rendering, for CPU bound update and draw work.
+	 *
+	 * Pipelined frames should take about as long as the slower of the two rather than their sum.
+	 */
+	void RunRenderPipelineBenchmark();
+
+	/**
+	 * @fn void RunFrameAllocatorBenchmark()
+	 * @brief Builds the same temporary vectors and strings every frame on the heap and in frame memory, and reports the frame memory high-water mark.
+	 */
+	void RunFrameAllocatorBenchmark();
+
+	/**
+	 * @fn void RunProfilerBenchmark()
+	 * @brief Measures the cost of a PROFILE_SCOPE zone while nothing is captured and while a capture records it.
+	 */
+	void RunProfilerBenchmark();
+
+	/**
+	 * @fn void RunLayerStackBenchmark()
+	 * @brief Measures a frame of LayerStack dispatch over many idle layers, with every layer in every phase and with the phases and event categories the layers declare.
+	 */
+	void RunLayerStackBenchmark();
+
+	/**
+	 * @fn void RunMemoryTrackerBenchmark()
+	 * @brief Measures a new/delete pair against malloc/free, plain, under a MEMORY_TAG_SCOPE and through INEPT_NEW with call-site capture on.
+	 */
+	void RunMemoryTrackerBenchmark();
+
+	/**
+	 * @fn void RunEventBusGridBenchmark(const std::string& jsonPath)
+	 * @brief Measures Publish + ProcessEvents and PublishNow over a grid of event mixes, filter shapes, subscriber counts and publisher threads.
+	 *
+	 * Every cell reports events per second and the p50/p99 latency from creating an event to it being dispatched. The results
+	 * are printed as a table and written as JSON, so runs of different builds can be compared.
+	 *
+	 * @param jsonPath The file the JSON results are written to
+	 */
+	void RunEventBusGridBenchmark(const std::string& jsonPath);
+} // namespace IneptBenchmark
@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+
+#include <Core/Clock.h>
+
+namespace IneptBenchmark {
+	void RunClockBenchmark()
+	{
+		using namespace IneptEngine::Events;
+		using IneptEngine::Core::Clock;
+
+		constexpr int iterations = 1000000;
+		constexpr int formatIterations = 100000;
+
+		std::cout << "Engine clock (" << iterations << " reads, " << formatIterations << " formats, " << Clock::GetTicksPerSecond() / 1e6 << " ticks/us)\n";
+		std::cout << std::format("{:<36} {:>12}\n", "operation", "ns/op");
+
+		uint64_t sink = 0;
+		auto report = [](const char* operation, double nanoseconds, int count) {
+			std::cout << std::format("{:<36} {:>12.2f}\n", operation, nanoseconds / count);
+		};
+
+		report("system_clock::now", MeasureNanoseconds([&]() {
+			for (int i = 0; i < iterations; i++) {
+				sink += static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+			}
+			}), iterations);
+
+		report("steady_clock::now", MeasureNanoseconds([&]() {
+			for (int i = 0; i < iterations; i++) {
+				sink += static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+			}
+			}), iterations);
+
+		report("Clock::Now", MeasureNanoseconds([&]() {
+			for (int i = 0; i < iterations; i++) {
+				sink += Clock::Now();
+			}
+			}), iterations);
+
+		report("construct KeyPressedEvent", MeasureNanoseconds([&]() {
+			for (int i = 0; i < iterations; i++) {
+				KeyPressedEvent event(Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				sink += event.GetTimestamp();
+			}
+			}), iterations);
+
+		// The time zone lookup every event did in GetTime before timestamps were formatted by the engine clock
+		report("zoned_time per call", MeasureNanoseconds([&]() {
+			for (int i = 0; i < formatIterations; i++) {
+				sink += std::format("{:%T}", std::chrono::zoned_time(std::chrono::current_zone(), std::chrono::system_clock::now())).size();
+			}
+			}), formatIterations);
+
+		report("Clock::FormatTime", MeasureNanoseconds([&]() {
+			for (int i = 0; i < formatIterations; i++) {
+				sink += Clock::FormatTime(Clock::Now()).size();
+			}
+			}), formatIterations);
+
+		KeyPressedEvent event(Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+		report("KeyPressedEvent::ToString", MeasureNanoseconds([&]() {
+			for (int i = 0; i < formatIterations; i++) {
+				sink += event.ToString().size();
+			}
+			}), formatIterations);
+
+		if (sink == 0) {
+			std::cout << "\n";
+		}
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,412 @@
+#include "Benchmark.h"
+
+namespace IneptBenchmark {
+	bool RunDispatchScalingBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int eventsPerRun = 10000;
+		constexpr int runs = 20;
+		const int unrelatedCounts[] = { 0, 16, 64, 256, 1024 };
+
+		EventBus& bus = EventBus::GetInstance();
+
+		int handled = 0;
+		SubscriptionToken handler = EVENT_SUBSCRIBE(KeyPressed, [&handled](Event* e) {
+			handled++;
+			});
+
+		std::cout << "EventBus dispatch scaling (" << eventsPerRun << " KeyPressed events per run)\n";
+		std::cout << std::format("{:>22} {:>16}\n", "unrelated subscribers", "ns/event");
+
+		std::vector<SubscriptionToken> unrelatedSubscriptions;
+		for (int unrelated : unrelatedCounts) {
+			// Subscribers to other types and categories never fire for KeyPressed events
+			while (unrelatedSubscriptions.size() < static_cast<size_t>(unrelated)) {
+				if (unrelatedSubscriptions.size() % 2 == 0) {
+					unrelatedSubscriptions.push_back(bus.Subscribe(EventType::WindowMoved, [](Event* e) {}));
+				}
+				else {
+					unrelatedSubscriptions.push_back(bus.Subscribe(static_cast<EventCategory>(EventCategory::Window | EventCategory::Application), [](Event* e) {}));
+				}
+			}
+
+			double best = std::numeric_limits<double>::max();
+			for (int run = 0; run < runs; run++) {
+				for (int i = 0; i < eventsPerRun; i++) {
+					EVENT_PUBLISH(KeyPressedEvent, Keyboard::Key::KEY_W, Keyboard::KeyModifier::None);
+				}
+				double elapsed = MeasureNanoseconds([]() { EVENT_PROCESS(); });
+				best = (std::min)(best, elapsed / eventsPerRun);
+			}
+
+			std::cout << std::format("{:>22} {:>16.2f}\n", unrelated, best);
+		}
+
+		if (handled != eventsPerRun * runs * static_cast<int>(std::size(unrelatedCounts))) {
+			std::cout << "Unexpected handler call count: " << handled << "\n";
+			return false;
+		}
+		return true;
+	}
+
+	void RunStorageModeBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int burstSize = 4000;
+		constexpr int runs = 20;
+
+		EventBus& bus = EventBus::GetInstance();
+
+		float sum = 0.0f;
+		SubscriptionToken handler = EVENT_SUBSCRIBE(MouseMoved, [&sum](Event* e) {
+			sum += static_cast<MouseMovedEvent*>(e)->GetX();
+			});
+
+		// Every event of the burst has to be dispatched for the modes to be compared
+		bus.SetCoalescingPolicy<MouseMovedEvent>(CoalescingPolicy::KeepAll);
+
+		std::cout << "EventBus storage modes (" << burstSize << " mixed input events per burst)\n";
+		std::cout << std::format("{:>12} {:>16} {:>16}\n", "mode", "publish ns/event", "process ns/event");
+
+		for (EventStorageMode mode : { EventStorageMode::Polymorphic, EventStorageMode::Contiguous }) {
+			bus.SetStorageMode(mode);
+
+			double bestPublish = std::numeric_limits<double>::max();
+			double bestProcess = std::numeric_limits<double>::max();
+			for (int run = 0; run < runs; run++) {
+				double publish = MeasureNanoseconds([]() {
+					for (int i = 0; i < burstSize; i++) {
+						if (i % 4 == 0) {
+							EVENT_PUBLISH(KeyPressedEvent, Keyboard::Key::KEY_W, Keyboard::KeyModifier::None);
+						}
+						else {
+							EVENT_PUBLISH(MouseMovedEvent, static_cast<float>(i), 0.0f);
+						}
+					}
+					});
+				double process = MeasureNanoseconds([]() { EVENT_PROCESS(); });
+				bestPublish = (std::min)(bestPublish, publish / burstSize);
+				bestProcess = (std::min)(bestProcess, process / burstSize);
+			}
+
+			std::cout << std::format("{:>12} {:>16.2f} {:>16.2f}\n", mode == EventStorageMode::Polymorphic ? "polymorphic" : "contiguous", bestPublish, bestProcess);
+		}
+
+		bus.SetStorageMode(EventStorageMode::Polymorphic);
+		bus.SetCoalescingPolicy<MouseMovedEvent>(CoalescingPolicy::KeepLatest);
+	}
+
+	bool RunHandlerOverheadBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int handlers = 64;
+		constexpr int events = 2000;
+		constexpr int runs = 20;
+
+		// Both paths do the same work, one through std::function + std::bind and a cast, one through a typed handler
+		int legacyKeys = 0;
+		int typedKeys = 0;
+		std::vector<SubscriptionToken> subscriptions;
+		for (int i = 0; i < handlers; i++) {
+			subscriptions.push_back(EVENT_SUBSCRIBE(KeyReleased, [&legacyKeys](Event* e) {
+				legacyKeys += static_cast<KeyReleasedEvent*>(e)->GetKey();
+				}));
+			subscriptions.push_back(EVENT_SUBSCRIBE_TYPED(KeyTypedEvent, [&typedKeys](KeyTypedEvent& e) {
+				typedKeys += e.GetKey();
+				}));
+		}
+
+		double bestLegacy = std::numeric_limits<double>::max();
+		double bestTyped = std::numeric_limits<double>::max();
+		for (int run = 0; run < runs; run++) {
+			double legacy = MeasureNanoseconds([]() {
+				for (int i = 0; i < events; i++) {
+					EVENT_PUBLISH_NOW(KeyReleasedEvent, Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				}
+				});
+			double typed = MeasureNanoseconds([]() {
+				for (int i = 0; i < events; i++) {
+					EVENT_PUBLISH_NOW(KeyTypedEvent, Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				}
+				});
+			bestLegacy = (std::min)(bestLegacy, legacy / (events * handlers));
+			bestTyped = (std::min)(bestTyped, typed / (events * handlers));
+		}
+
+		std::cout << "EventBus handler overhead (" << handlers << " handlers, " << events << " events)\n";
+		std::cout << std::format("{:>22} {:>16}\n", "handler", "ns/handler call");
+		std::cout << std::format("{:>22} {:>16.2f}\n", "std::function + bind", bestLegacy);
+		std::cout << std::format("{:>22} {:>16.2f}\n", "Subscribe<T>", bestTyped);
+		std::cout << std::format("{:>22} {:>16.2f}\n", "saved", bestLegacy - bestTyped);
+
+		if (legacyKeys != typedKeys) {
+			std::cout << "Handler results differ: " << legacyKeys << " != " << typedKeys << "\n";
+			return false;
+		}
+		return true;
+	}
+
+	bool RunSubscriptionSoakBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int frames = 100000;
+		constexpr int reportInterval = 20000;
+		constexpr int churnPerFrame = 8;
+
+		EventBus& bus = EventBus::GetInstance();
+
+		// A long lived subscriber that is subscribed again every frame, as Application::Run used to do
+		int owner = 0;
+		int handled = 0;
+		SubscriptionToken handler = bus.Subscribe<KeyPressedEvent>([&handled](KeyPressedEvent& e) { handled++; }, &owner);
+
+		std::cout << "EventBus subscription soak (" << frames << " frames, " << churnPerFrame << " short lived subscribers per frame)\n";
+		std::cout << std::format("{:>12} {:>16} {:>16}\n", "frame", "subscribers", "ns/frame");
+
+		double elapsed = 0.0;
+		for (int frame = 1; frame <= frames; frame++) {
+			elapsed += MeasureNanoseconds([&]() {
+				SubscriptionToken duplicate = bus.Subscribe<KeyPressedEvent>([&handled](KeyPressedEvent& e) { handled++; }, &owner);
+
+				// Short lived subscribers, unsubscribed by their tokens at the end of the frame
+				std::array<SubscriptionToken, churnPerFrame> transient;
+				for (SubscriptionToken& token : transient) {
+					token = bus.Subscribe(EventType::KeyPressed, [](Event* e) {});
+				}
+
+				EVENT_PUBLISH(KeyPressedEvent, Keyboard::Key::KEY_W, Keyboard::KeyModifier::None);
+				EVENT_PROCESS();
+				});
+
+			if (frame % reportInterval == 0) {
+				std::cout << std::format("{:>12} {:>16} {:>16.2f}\n", frame, bus.GetSubscriberCount(), elapsed / reportInterval);
+				elapsed = 0.0;
+			}
+		}
+
+		if (handled != frames) {
+			std::cout << "Unexpected handler call count: " << handled << "\n";
+			return false;
+		}
+		return true;
+	}
+
+	void RunCoalescingBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int burstSize = 1000;
+		constexpr int runs = 20;
+
+		EventBus& bus = EventBus::GetInstance();
+
+		int dispatched = 0;
+		float scrolled = 0.0f;
+		SubscriptionToken movedHandler = EVENT_SUBSCRIBE_TYPED(MouseMovedEvent, [&dispatched](MouseMovedEvent& e) { dispatched++; });
+		SubscriptionToken scrolledHandler = bus.Subscribe<MouseScrolledEvent>([&dispatched, &scrolled](MouseScrolledEvent& e) {
+			dispatched++;
+			scrolled += e.GetYOffset();
+			});
+
+		std::cout << "EventBus coalescing (" << burstSize << " MouseMoved and " << burstSize << " MouseScrolled events per frame)\n";
+		std::cout << std::format("{:>12} {:>16} {:>16} {:>16} {:>16}\n", "policy", "frame ns", "dispatched", "merged", "scroll sum");
+
+		for (CoalescingPolicy policy : { CoalescingPolicy::KeepAll, CoalescingPolicy::KeepLatest }) {
+			bus.SetCoalescingPolicy<MouseMovedEvent>(policy);
+			if (policy == CoalescingPolicy::KeepAll) {
+				bus.SetCoalescingPolicy<MouseScrolledEvent>(CoalescingPolicy::KeepAll);
+			}
+			else {
+				bus.SetCoalescingPolicy<MouseScrolledEvent>([](MouseScrolledEvent& pending, const MouseScrolledEvent& incoming) {
+					pending = MouseScrolledEvent(pending.GetXOffset() + incoming.GetXOffset(), pending.GetYOffset() + incoming.GetYOffset());
+					});
+			}
+			bus.ResetCoalescingStats();
+
+			double best = std::numeric_limits<double>::max();
+			for (int run = 0; run < runs; run++) {
+				dispatched = 0;
+				scrolled = 0.0f;
+				double elapsed = MeasureNanoseconds([]() {
+					for (int i = 0; i < burstSize; i++) {
+						EVENT_PUBLISH(MouseMovedEvent, static_cast<float>(i), 0.0f);
+						EVENT_PUBLISH(MouseScrolledEvent, 0.0f, 1.0f);
+					}
+					EVENT_PROCESS();
+					});
+				best = (std::min)(best, elapsed);
+			}
+
+			// The scroll sum must be the same whether scroll events were merged or not
+			std::cout << std::format("{:>12} {:>16.0f} {:>16} {:>16} {:>16.0f}\n", policy == CoalescingPolicy::KeepAll ? "keep all" : "coalesced",
+				best, dispatched, bus.GetCoalescingStats().mergedCount / runs, scrolled);
+		}
+	}
+
+	bool RunConcurrentDispatchBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int heavyHandlers = 4;
+		constexpr int events = 500;
+		constexpr int workPerEvent = 2000;
+		constexpr int runs = 10;
+
+		EventBus& bus = EventBus::GetInstance();
+
+		// Stands in for analytics or AI perception listeners that do real work per event
+		auto work = [](float x) {
+			float value = x;
+			for (int i = 0; i < workPerEvent; i++) {
+				value = value * 0.5f + 1.0f;
+			}
+			return value;
+		};
+
+		std::cout << "EventBus concurrent dispatch (" << heavyHandlers << " heavy handlers, " << events << " events per frame)\n";
+		std::cout << std::format("{:>12} {:>16} {:>16}\n", "handlers", "frame us", "out of order");
+
+		// Both ways of calling the handlers must give the same results
+		std::array<float, heavyHandlers> mainThreadResults{};
+		bool passed = true;
+		for (SubscriptionFlags flags : { SubscriptionFlags::None, SubscriptionFlags::Concurrent }) {
+			// Every handler checks that it receives the events of a frame in the order they were published
+			std::array<float, heavyHandlers> lastKey{};
+			std::array<float, heavyHandlers> results{};
+			std::atomic<int> outOfOrder = 0;
+			std::vector<SubscriptionToken> subscriptions;
+			for (int h = 0; h < heavyHandlers; h++) {
+				auto handler = [&, h](const KeyTypedEvent& e) {
+					float key = static_cast<float>(e.GetKey());
+					if (key < lastKey[h]) {
+						outOfOrder++;
+					}
+					lastKey[h] = key;
+					results[h] += work(key);
+				};
+				subscriptions.push_back(flags == SubscriptionFlags::Concurrent ? bus.SubscribeConcurrent<KeyTypedEvent>(handler) : bus.Subscribe<KeyTypedEvent>(handler));
+			}
+
+			double best = std::numeric_limits<double>::max();
+			for (int run = 0; run < runs; run++) {
+				lastKey.fill(0.0f);
+				for (int i = 0; i < events; i++) {
+					EVENT_PUBLISH(KeyTypedEvent, static_cast<Keyboard::Key>(i), Keyboard::KeyModifier::None);
+				}
+				best = (std::min)(best, MeasureNanoseconds([]() { EVENT_PROCESS(); }) / 1000.0);
+			}
+
+			std::cout << std::format("{:>12} {:>16.1f} {:>16}\n", flags == SubscriptionFlags::Concurrent ? "concurrent" : "main thread", best, outOfOrder.load());
+
+			passed &= outOfOrder.load() == 0;
+			if (flags == SubscriptionFlags::None) {
+				mainThreadResults = results;
+			}
+			else if (results != mainThreadResults) {
+				std::cout << "Concurrent handler results differ from the main thread ones\n";
+				passed = false;
+			}
+		}
+		return passed;
+	}
+
+	void RunStatsOverheadBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr int events = 10000;
+		constexpr int runs = 20;
+
+		EventBus& bus = EventBus::GetInstance();
+
+		int keys = 0;
+		SubscriptionToken lightHandler = EVENT_SUBSCRIBE_TYPED(KeyReleasedEvent, [&keys](KeyReleasedEvent& e) { keys++; });
+		SubscriptionToken heavyHandler = EVENT_SUBSCRIBE_TYPED(KeyReleasedEvent, [&keys](KeyReleasedEvent& e) {
+			for (int i = 0; i < 100; i++) {
+				keys += e.GetKey() & i;
+			}
+			});
+		bus.SetSubscriptionName(lightHandler.GetHandle(), "light handler");
+		bus.SetSubscriptionName(heavyHandler.GetHandle(), "heavy handler");
+
+		std::cout << "EventBus stats overhead (" << events << " KeyReleased events, 2 handlers)\n";
+		std::cout << std::format("{:>12} {:>16}\n", "stats", "ns/event");
+
+		for (bool enabled : { false, true }) {
+			bus.SetStatsEnabled(enabled);
+			bus.ResetStats();
+
+			double best = std::numeric_limits<double>::max();
+			for (int run = 0; run < runs; run++) {
+				for (int i = 0; i < events; i++) {
+					EVENT_PUBLISH(KeyReleasedEvent, Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				}
+				best = (std::min)(best, MeasureNanoseconds([]() { EVENT_PROCESS(); }) / events);
+			}
+
+			std::cout << std::format("{:>12} {:>16.2f}\n", enabled ? "enabled" : "disabled", best);
+		}
+
+		bus.DumpStats();
+		bus.SetStatsEnabled(false);
+		bus.ResetStats();
+	}
+
+	void RunTimerWheelBenchmark()
+	{
+		using namespace IneptEngine::Events;
+
+		constexpr uint64_t maxDelay = 60000;
+		constexpr uint64_t ticksPerFrame = 16;
+		constexpr int frames = 600;
+		const size_t timerCounts[] = { 1000, 10000, 100000 };
+
+		std::cout << "TimerWheel scaling (1 ms ticks, delays up to " << maxDelay << " ms, " << frames << " frames of " << ticksPerFrame << " ticks)\n";
+		std::cout << std::format("{:>16} {:>16} {:>16} {:>16} {:>16}\n", "pending timers", "ns/schedule", "ns/cancel", "ns/frame", "fired/frame");
+
+		for (size_t timerCount : timerCounts) {
+			TimerWheel wheel;
+			std::vector<TimerHandle> handles;
+			handles.reserve(timerCount);
+			std::vector<EventVariant> firedEvents;
+
+			uint64_t seed = 1;
+			auto nextDelay = [&seed]() {
+				seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+				return 1 + (seed >> 33) % maxDelay;
+			};
+
+			double scheduleTime = MeasureNanoseconds([&]() {
+				for (size_t i = 0; i < timerCount; i++) {
+					handles.push_back(wheel.Schedule(nextDelay(), 0, EventVariant(std::in_place_type<AppTickEvent>)));
+				}
+				});
+
+			// Every fired timer is replaced, so the number of pending timers stays the same for the whole run
+			size_t fired = 0;
+			double advanceTime = MeasureNanoseconds([&]() {
+				for (int frame = 0; frame < frames; frame++) {
+					firedEvents.clear();
+					wheel.Advance(wheel.GetCurrentTick() + ticksPerFrame - 1, firedEvents);
+					fired += firedEvents.size();
+					for (size_t i = 0; i < firedEvents.size(); i++) {
+						wheel.Schedule(wheel.GetCurrentTick() + nextDelay(), 0, EventVariant(std::in_place_type<AppTickEvent>));
+					}
+				}
+				});
+
+			double cancelTime = MeasureNanoseconds([&]() {
+				for (TimerHandle handle : handles) {
+					wheel.Cancel(handle);
+				}
+				});
+
+			std::cout << std::format("{:>16} {:>16.1f} {:>16.1f} {:>16.1f} {:>16.1f}\n", timerCount, scheduleTime / timerCount,
+				cancelTime / timerCount, advanceTime / frames, static_cast<double>(fired) / frames);
+		}
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,271 @@
+#include "Benchmark.h"
+
+namespace IneptBenchmark {
+	namespace {
+		using namespace IneptEngine::Events;
+		using IneptEngine::Core::Clock;
+
+		// Events per round, equal to the capacity of the event buffer of one publishing thread so publishing never overflows
+		constexpr int EventsPerRound = static_cast<int>(EventBus::EventQueueCapacity);
+		constexpr int Rounds = 32;
+
+		/**
+		 * @brief The event types published by a benchmark cell, and the categories category subscribers pick from
+		 */
+		struct EventMix {
+			const char* name;
+			std::vector<EventType> types;
+			std::vector<EventCategory> categories;
+		};
+
+		/**
+		 * @brief How the subscribers of a benchmark cell select their events
+		 */
+		enum class FilterShape {
+			Type,
+			Category,
+			Mixed
+		};
+
+		const char* FilterShapeToString(FilterShape shape) {
+			switch (shape) {
+			case FilterShape::Type:
+				return "type";
+			case FilterShape::Category:
+				return "category";
+			case FilterShape::Mixed:
+				return "mixed";
+			}
+			return "unknown";
+		}
+
+		/**
+		 * @brief One point of the grid, and what was measured for it
+		 */
+		struct GridResult {
+			const char* operation;
+			const char* mix;
+			const char* filter;
+			int subscribers;
+			int threads;
+			size_t events;
+			uint64_t handlerCalls;
+			double eventsPerSecond;
+			double publishEventsPerSecond;
+			double processEventsPerSecond;
+			uint64_t latencyP50;
+			uint64_t latencyP99;
+		};
+
+		/**
+		 * @brief Publishes the i-th event of a mix, either queued or dispatched immediately
+		 */
+		template<bool Now>
+		void PublishMixed(const EventMix& mix, int i) {
+			EventBus& bus = EventBus::GetInstance();
+			auto publish = [&bus]<typename T, typename... Args>(Args&&... args) {
+				if constexpr (Now) {
+					bus.PublishNow<T>(std::forward<Args>(args)...);
+				}
+				else {
+					bus.Publish<T>(std::forward<Args>(args)...);
+				}
+			};
+
+			// Only types without a default coalescing policy are used, every published event has to be dispatched
+			switch (mix.types[i % mix.types.size()]) {
+			case EventType::KeyPressed:
+				publish.template operator()<KeyPressedEvent>(Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				break;
+			case EventType::KeyReleased:
+				publish.template operator()<KeyReleasedEvent>(Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+				break;
+			case EventType::MouseButtonPressed:
+				publish.template operator()<MouseButtonPressedEvent>(IneptEngine::Input::MouseButton::MOUSE1, 1.0f, 2.0f);
+				break;
+			case EventType::MouseButtonReleased:
+				publish.template operator()<MouseButtonReleasedEvent>(IneptEngine::Input::MouseButton::MOUSE1, 1.0f, 2.0f);
+				break;
+			case EventType::AppUpdate:
+				publish.template operator()<AppUpdateEvent>();
+				break;
+			case EventType::AppTick:
+				publish.template operator()<AppTickEvent>();
+				break;
+			case EventType::WindowFocus:
+				publish.template operator()<WindowFocusEvent>();
+				break;
+			case EventType::WindowLostFocus:
+				publish.template operator()<WindowLostFocusEvent>();
+				break;
+			default:
+				break;
+			}
+		}
+
+		/**
+		 * @brief Subscribes the handlers of a cell, type subscribers and category subscribers take turns over the mix
+		 */
+		std::vector<SubscriptionToken> SubscribeHandlers(const EventMix& mix, FilterShape shape, int subscribers, uint64_t& handlerCalls) {
+			EventBus& bus = EventBus::GetInstance();
+			std::vector<SubscriptionToken> tokens;
+			for (int i = 0; i < subscribers; i++) {
+				bool byType = shape == FilterShape::Type || (shape == FilterShape::Mixed && i % 2 == 0);
+				if (byType) {
+					tokens.push_back(bus.Subscribe(mix.types[i % mix.types.size()], [&handlerCalls](Event* e) { handlerCalls++; }));
+				}
+				else {
+					tokens.push_back(bus.Subscribe(mix.categories[i % mix.categories.size()], [&handlerCalls](Event* e) { handlerCalls++; }));
+				}
+			}
+			return tokens;
+		}
+
+		uint64_t Percentile(std::vector<uint64_t>& samples, double percentile) {
+			if (samples.empty()) {
+				return 0;
+			}
+			size_t index = (std::min)(samples.size() - 1, static_cast<size_t>(percentile * static_cast<double>(samples.size())));
+			std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+			return samples[index];
+		}
+
+		/**
+		 * @brief Measures one cell of the grid
+		 * @param now True to measure PublishNow, false to measure Publish followed by ProcessEvents
+		 */
+		GridResult RunCell(bool now, const EventMix& mix, FilterShape shape, int subscribers, int threads) {
+			EventBus& bus = EventBus::GetInstance();
+
+			uint64_t handlerCalls = 0;
+			std::vector<SubscriptionToken> tokens = SubscribeHandlers(mix, shape, subscribers, handlerCalls);
+
+			// The probe receives every event after the type subscribers of its type, and measures the time since the event was created
+			std::vector<uint64_t> latencies;
+			latencies.reserve(static_cast<size_t>(EventsPerRound) * Rounds);
+			SubscriptionToken probe = bus.Subscribe(ALL_CATEGORIES, [&latencies](Event* e) {
+				latencies.push_back(Clock::ElapsedNanoseconds(e->GetTimestamp(), Clock::Now()));
+				});
+
+			// One warm up round so the arenas, queues and handler lists are touched before measuring
+			double publishTime = 0.0;
+			double processTime = 0.0;
+			for (int round = -1; round < Rounds; round++) {
+				double roundPublish = 0.0;
+				double roundProcess = 0.0;
+				if (now) {
+					roundPublish = MeasureNanoseconds([&mix]() {
+						for (int i = 0; i < EventsPerRound; i++) {
+							PublishMixed<true>(mix, i);
+						}
+						});
+				}
+				else {
+					// Publisher threads are started before timing and released together
+					std::atomic<bool> start = false;
+					std::vector<std::thread> publishers;
+					for (int thread = 0; thread < threads; thread++) {
+						publishers.emplace_back([&mix, &start, thread, threads]() {
+							while (!start.load(std::memory_order_acquire)) {
+								std::this_thread::yield();
+							}
+							for (int i = thread; i < EventsPerRound; i += threads) {
+								PublishMixed<false>(mix, i);
+							}
+							});
+					}
+					roundPublish = MeasureNanoseconds([&start, &publishers]() {
+						start.store(true, std::memory_order_release);
+						for (std::thread& publisher : publishers) {
+							publisher.join();
+						}
+						});
+					roundProcess = MeasureNanoseconds([&bus]() { bus.ProcessEvents(); });
+				}
+
+				if (round < 0) {
+					latencies.clear();
+					handlerCalls = 0;
+					continue;
+				}
+				publishTime += roundPublish;
+				processTime += roundProcess;
+			}
+
+			size_t events = static_cast<size_t>(EventsPerRound) * Rounds;
+			GridResult result = {};
+			result.operation = now ? "PublishNow" : "Publish+ProcessEvents";
+			result.mix = mix.name;
+			result.filter = FilterShapeToString(shape);
+			result.subscribers = subscribers;
+			result.threads = threads;
+			result.events = events;
+			result.handlerCalls = handlerCalls;
+			result.eventsPerSecond = events * 1e9 / (publishTime + processTime);
+			result.publishEventsPerSecond = events * 1e9 / publishTime;
+			result.processEventsPerSecond = now ? 0.0 : events * 1e9 / processTime;
+			result.latencyP50 = Percentile(latencies, 0.50);
+			result.latencyP99 = Percentile(latencies, 0.99);
+			return result;
+		}
+
+		std::string ToJson(const std::vector<GridResult>& results) {
+			std::string json = "{\n";
+			json += "  \"benchmark\": \"EventBus\",\n";
+			json += std::format("  \"eventsPerRound\": {},\n  \"rounds\": {},\n  \"hardwareThreads\": {},\n", EventsPerRound, Rounds, std::thread::hardware_concurrency());
+			json += "  \"results\": [\n";
+			for (size_t i = 0; i < results.size(); i++) {
+				const GridResult& result = results[i];
+				json += std::format("    {{\"operation\": \"{}\", \"mix\": \"{}\", \"filter\": \"{}\", \"subscribers\": {}, \"threads\": {}, "
+					"\"events\": {}, \"handlerCalls\": {}, \"eventsPerSecond\": {:.0f}, \"publishEventsPerSecond\": {:.0f}, "
+					"\"processEventsPerSecond\": {:.0f}, \"latencyP50Ns\": {}, \"latencyP99Ns\": {}}}{}\n",
+					result.operation, result.mix, result.filter, result.subscribers, result.threads,
+					result.events, result.handlerCalls, result.eventsPerSecond, result.publishEventsPerSecond,
+					result.processEventsPerSecond, result.latencyP50, result.latencyP99, i + 1 < results.size() ? "," : "");
+			}
+			json += "  ]\n}\n";
+			return json;
+		}
+	} // namespace
+
+	void RunEventBusGridBenchmark(const std::string& jsonPath)
+	{
+		const EventMix mixes[] = {
+			{ "key", { EventType::KeyPressed }, { EventCategory::Keyboard, EventCategory::Input } },
+			{ "input", { EventType::KeyPressed, EventType::KeyReleased, EventType::MouseButtonPressed, EventType::MouseButtonReleased },
+				{ EventCategory::Keyboard, EventCategory::MouseButton, EventCategory::Input } },
+			{ "all", { EventType::KeyPressed, EventType::MouseButtonPressed, EventType::AppUpdate, EventType::AppTick, EventType::WindowFocus, EventType::WindowLostFocus },
+				{ EventCategory::Keyboard, EventCategory::MouseButton, EventCategory::Application, EventCategory::Window } }
+		};
+		const int subscriberCounts[] = { 1, 16, 256 };
+		const int threadCounts[] = { 1, 2, 4 };
+		const FilterShape shapes[] = { FilterShape::Type, FilterShape::Category, FilterShape::Mixed };
+
+		std::vector<GridResult> results;
+		for (const EventMix& mix : mixes) {
+			for (FilterShape shape : shapes) {
+				for (int subscribers : subscriberCounts) {
+					for (int threads : threadCounts) {
+						results.push_back(RunCell(false, mix, shape, subscribers, threads));
+					}
+					results.push_back(RunCell(true, mix, shape, subscribers, 1));
+				}
+			}
+		}
+
+		std::cout << "EventBus grid (" << results.size() << " cells, " << EventsPerRound * Rounds << " events each)\n";
+		std::cout << std::format("{:<22} {:>6} {:>9} {:>6} {:>8} {:>14} {:>10} {:>10}\n", "operation", "mix", "filter", "subs", "threads", "events/s", "p50 ns", "p99 ns");
+		for (const GridResult& result : results) {
+			std::cout << std::format("{:<22} {:>6} {:>9} {:>6} {:>8} {:>14.0f} {:>10} {:>10}\n", result.operation, result.mix, result.filter,
+				result.subscribers, result.threads, result.eventsPerSecond, result.latencyP50, result.latencyP99);
+		}
+
+		std::ofstream file(jsonPath);
+		if (!file) {
+			std::cout << "Could not write " << jsonPath << "\n";
+			return;
+		}
+		file << ToJson(results);
+		std::cout << "Results written to " << jsonPath << "\n";
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,84 @@
+#include "Benchmark.h"
+
+namespace IneptBenchmark {
+	void RunEventChannelBenchmark()
+	{
+		using namespace IneptEngine::Events;
+		using IneptEngine::Core::Clock;
+
+		constexpr int throughputEvents = 1000000;
+		constexpr int roundTrips = 20000;
+
+		// Both ends live in this process but map the shared memory separately, like an editor and a game process would
+		EventChannel host;
+		EventChannel client;
+		if (!host.Create("IneptBenchmark") || !client.Open("IneptBenchmark")) {
+			std::cout << "EventChannel benchmark skipped, shared memory is not available\n";
+			return;
+		}
+
+		std::cout << "EventChannel loopback (" << throughputEvents << " events one way, " << roundTrips << " round trips)\n";
+
+		// The client counts what arrives while the host sends as fast as the ring allows
+		std::atomic<bool> stop = false;
+		std::atomic<int> received = 0;
+		std::thread reader([&client, &stop, &received]() {
+			EventVariant event;
+			while (!stop.load(std::memory_order_relaxed)) {
+				if (client.Receive(event)) {
+					received.fetch_add(1, std::memory_order_relaxed);
+				}
+				else {
+					std::this_thread::yield();
+				}
+			}
+			});
+
+		MouseMovedEvent moved(1.0f, 2.0f);
+		double sendTime = MeasureNanoseconds([&]() {
+			for (int i = 0; i < throughputEvents; i++) {
+				while (!host.Send(moved)) {
+					std::this_thread::yield();
+				}
+			}
+			while (received.load(std::memory_order_relaxed) < throughputEvents) {
+				std::this_thread::yield();
+			}
+			});
+		stop.store(true);
+		reader.join();
+
+		// The client sends every event straight back, the host waits for each one before sending the next
+		stop.store(false);
+		std::thread echo([&client, &stop]() {
+			EventVariant event;
+			while (!stop.load(std::memory_order_relaxed)) {
+				if (client.Receive(event)) {
+					client.Send(*GetEvent(event));
+				}
+				else {
+					std::this_thread::yield();
+				}
+			}
+			});
+
+		std::vector<uint64_t> latencies;
+		latencies.reserve(roundTrips);
+		EventVariant reply;
+		for (int i = 0; i < roundTrips; i++) {
+			KeyPressedEvent pressed(Keyboard::Key::KEY_A, Keyboard::KeyModifier::None);
+			host.Send(pressed);
+			while (!host.Receive(reply)) {
+				std::this_thread::yield();
+			}
+			latencies.push_back(Clock::ElapsedNanoseconds(GetEvent(reply)->GetTimestamp(), Clock::Now()));
+		}
+		stop.store(true);
+		echo.join();
+
+		std::sort(latencies.begin(), latencies.end());
+		std::cout << std::format("{:>14} {:>20} {:>20} {:>24}\n", "events/s", "round trip p50 ns", "round trip p99 ns", "sends to a full ring");
+		std::cout << std::format("{:>14.0f} {:>20} {:>20} {:>24}\n", throughputEvents * 1e9 / sendTime,
+			latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100], host.GetDroppedCount());
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,55 @@
+#include "Benchmark.h"
+
+#include <Core/FrameAllocator.h>
+
+namespace IneptBenchmark {
+	void RunFrameAllocatorBenchmark()
+	{
+		using namespace IneptEngine::Core;
+
+		constexpr int frames = 2000;
+		constexpr int containersPerFrame = 64;
+		constexpr int elementsPerContainer = 100;
+
+		std::cout << "Frame allocator (" << frames << " frames, " << containersPerFrame << " temporary vectors and strings per frame)\n";
+		std::cout << std::format("{:>12} {:>12}\n", "allocator", "ns/frame");
+
+		// The same temporary containers a frame of layer and render code builds, once on the heap and once in frame memory
+		size_t checksum = 0;
+		double heapTime = MeasureNanoseconds([&]() {
+			for (int frame = 0; frame < frames; frame++) {
+				for (int i = 0; i < containersPerFrame; i++) {
+					std::vector<int> values;
+					for (int j = 0; j < elementsPerContainer; j++) {
+						values.push_back(j);
+					}
+					std::string name = std::format("uniform_name_{}_{}", frame, i);
+					checksum += values.size() + name.size();
+				}
+			}
+			});
+
+		FrameAllocator::BeginFrame();
+		FrameAllocatorStats before = FrameAllocator::GetStats();
+		double frameTime = MeasureNanoseconds([&]() {
+			for (int frame = 0; frame < frames; frame++) {
+				FrameAllocator::BeginFrame();
+				for (int i = 0; i < containersPerFrame; i++) {
+					FrameVector<int> values(FrameAllocator::GetMemoryResource());
+					for (int j = 0; j < elementsPerContainer; j++) {
+						values.push_back(j);
+					}
+					FrameString name(FrameAllocator::GetMemoryResource());
+					std::format_to(std::back_inserter(name), "uniform_name_{}_{}", frame, i);
+					checksum += values.size() + name.size();
+				}
+			}
+			});
+		FrameAllocatorStats after = FrameAllocator::GetStats();
+
+		std::cout << std::format("{:>12} {:>12.0f}\n", "heap", heapTime / frames);
+		std::cout << std::format("{:>12} {:>12.0f}\n", "frame", frameTime / frames);
+		std::cout << std::format("High-water mark {} bytes, {} bytes reserved, {} heap allocations over {} frames (checksum {})\n",
+			after.peakFrameBytes, after.reservedBytes, after.heapAllocations - before.heapAllocations, frames, checksum);
+	}
+} // namespace IneptBenchmark
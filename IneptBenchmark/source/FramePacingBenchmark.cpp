@@ -0,0 +1,33 @@
+#include "Benchmark.h"
+
+#include <Core/FramePacer.h>
+
+namespace IneptBenchmark {
+	void RunFramePacingBenchmark()
+	{
+		using IneptEngine::Core::Clock;
+		using IneptEngine::Core::FramePacer;
+		using IneptEngine::Core::FramePacingStats;
+
+		const double frameRates[] = { 60.0, 144.0, 240.0 };
+
+		std::cout << "Frame pacing (one second per frame rate, 2 ms of work per frame)\n";
+		std::cout << std::format("{:>6} {:>8} {:>12} {:>12} {:>14} {:>14} {:>14}\n", "fps", "frames", "target ms", "mean ms", "jitter p50 us", "jitter p99 us", "jitter max us");
+		for (double frameRate : frameRates) {
+			FramePacer pacer;
+			pacer.SetTargetFrameRate(frameRate);
+			for (int frame = 0; frame <= static_cast<int>(frameRate); frame++) {
+				pacer.WaitForNextFrame();
+
+				// Stands in for the update and render of a frame
+				Clock::Ticks workEnd = Clock::Now() + Clock::FromNanoseconds(2'000'000);
+				while (Clock::Now() < workEnd) {
+				}
+			}
+
+			FramePacingStats stats = pacer.GetStats();
+			std::cout << std::format("{:>6} {:>8} {:>12.3f} {:>12.3f} {:>14.1f} {:>14.1f} {:>14.1f}\n", frameRate, stats.frameCount,
+				stats.targetFrameTime / 1e6, stats.meanFrameTime / 1e6, stats.jitterP50 / 1e3, stats.jitterP99 / 1e3, stats.jitterMax / 1e3);
+		}
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,69 @@
+#include "Benchmark.h"
+
+/**
+ * @fn int main(int argc, char** argv)
+ * @brief Entry point for the benchmark runner
+ *
+ * Benchmarks run without a window or a rendering context, so only the engine systems under test are measured.
+ * Options:
+ *   --check          Only runs the correctness checks, registered as a test so CI runs it
+ *   --grid-only      Only runs the EventBus grid benchmark
+ *   --json <path>    Where the grid results are written, EventBusBenchmark.json by default
+ *
+ * Returns non-zero if a correctness check failed.
+ */
+int main(int argc, char** argv) {
+	bool checkOnly = false;
+	bool gridOnly = false;
+	std::string jsonPath = "EventBusBenchmark.json";
+	for (int i = 1; i < argc; i++) {
+		std::string_view arg = argv[i];
+		if (arg == "--check") {
+			checkOnly = true;
+		}
+		else if (arg == "--grid-only") {
+			gridOnly = true;
+		}
+		else if (arg == "--json" && i + 1 < argc) {
+			jsonPath = argv[++i];
+		}
+	}
+
+	if (!gridOnly) {
+		// The correctness check goes first, timings of a broken job system mean nothing
+		if (!IneptBenchmark::RunJobSystemStressTest()) {
+			return 1;
+		}
+
+		// These benchmarks also check the results of the handlers they time
+		bool passed = true;
+		passed &= IneptBenchmark::RunDispatchScalingBenchmark();
+		passed &= IneptBenchmark::RunHandlerOverheadBenchmark();
+		passed &= IneptBenchmark::RunSubscriptionSoakBenchmark();
+		passed &= IneptBenchmark::RunConcurrentDispatchBenchmark();
+		if (!passed) {
+			std::cout << "Correctness checks FAILED\n";
+			return 1;
+		}
+		if (checkOnly) {
+			std::cout << "Correctness checks passed\n";
+			return 0;
+		}
+
+		IneptBenchmark::RunStorageModeBenchmark();
+		IneptBenchmark::RunCoalescingBenchmark();
+		IneptBenchmark::RunStatsOverheadBenchmark();
+		IneptBenchmark::RunTimerWheelBenchmark();
+		IneptBenchmark::RunClockBenchmark();
+		IneptBenchmark::RunEventChannelBenchmark();
+		IneptBenchmark::RunFramePacingBenchmark();
+		IneptBenchmark::RunJobSystemBenchmark();
+		IneptBenchmark::RunRenderPipelineBenchmark();
+		IneptBenchmark::RunFrameAllocatorBenchmark();
+		IneptBenchmark::RunProfilerBenchmark();
+		IneptBenchmark::RunLayerStackBenchmark();
+		IneptBenchmark::RunMemoryTrackerBenchmark();
+	}
+	IneptBenchmark::RunEventBusGridBenchmark(jsonPath);
+	return 0;
+}
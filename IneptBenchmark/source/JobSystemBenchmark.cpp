@@ -0,0 +1,195 @@
+#include "Benchmark.h"
+
+#include <Core/JobSystem.h>
+#include <Core/WorkStealingDeque.h>
+
+#include <random>
+
+namespace IneptBenchmark {
+	namespace {
+		// The owner pushes every item once, in bursts of pushes and pops, while the thieves steal until it is done
+		bool StressWorkStealingDeque(size_t itemCount, size_t thiefCount) {
+			using IneptEngine::Core::WorkStealingDeque;
+
+			// A small deque so it runs full and empty all the time, which is where the owner and the thieves race
+			WorkStealingDeque<uint32_t*, 64> deque;
+			std::vector<uint32_t> items(itemCount);
+			std::vector<std::atomic<uint32_t>> takenCounts(itemCount);
+			std::atomic<bool> done = false;
+
+			auto take = [&](uint32_t* item) {
+				takenCounts[static_cast<size_t>(item - items.data())].fetch_add(1, std::memory_order_relaxed);
+			};
+
+			std::vector<std::thread> thieves;
+			for (size_t i = 0; i < thiefCount; i++) {
+				thieves.emplace_back([&]() {
+					while (!done.load(std::memory_order_acquire)) {
+						if (uint32_t* item = deque.Steal()) {
+							take(item);
+						}
+					}
+					});
+			}
+
+			std::mt19937 random(12345);
+			size_t next = 0;
+			while (next < itemCount) {
+				size_t pushes = random() % 32;
+				for (size_t i = 0; i < pushes && next < itemCount; i++) {
+					if (!deque.Push(&items[next])) {
+						break;
+					}
+					next++;
+				}
+				size_t pops = random() % 32;
+				for (size_t i = 0; i < pops; i++) {
+					if (uint32_t* item = deque.Pop()) {
+						take(item);
+					}
+				}
+			}
+			while (uint32_t* item = deque.Pop()) {
+				take(item);
+			}
+			// A thief may still be holding an item it stole, they have all finished once joined
+			done.store(true, std::memory_order_release);
+			for (std::thread& thief : thieves) {
+				thief.join();
+			}
+			while (uint32_t* item = deque.Steal()) {
+				take(item);
+			}
+
+			size_t wrong = 0;
+			for (std::atomic<uint32_t>& count : takenCounts) {
+				wrong += count.load() != 1 ? 1 : 0;
+			}
+			return wrong == 0;
+		}
+
+		// Every job submits a few more, so jobs are pushed by workers, popped by their owner and stolen at once
+		bool StressJobSystem(size_t threadCount, size_t rootJobCount) {
+			using IneptEngine::Core::JobSystem;
+			using IneptEngine::Core::JobCounter;
+
+			constexpr size_t childrenPerJob = 4;
+			JobSystem& jobs = JobSystem::GetInstance();
+			jobs.SetThreadCount(threadCount);
+
+			std::vector<std::atomic<uint32_t>> runCounts(rootJobCount * (childrenPerJob + 1));
+			JobCounter counter;
+			for (size_t root = 0; root < rootJobCount; root++) {
+				jobs.Submit([&, root]() {
+					runCounts[root * (childrenPerJob + 1)].fetch_add(1, std::memory_order_relaxed);
+					for (size_t child = 1; child <= childrenPerJob; child++) {
+						jobs.Submit([&runCounts, index = root * (childrenPerJob + 1) + child]() {
+							runCounts[index].fetch_add(1, std::memory_order_relaxed);
+							}, &counter);
+					}
+					}, &counter);
+			}
+			jobs.Wait(counter);
+
+			size_t wrong = 0;
+			for (std::atomic<uint32_t>& count : runCounts) {
+				wrong += count.load() != 1 ? 1 : 0;
+			}
+			return wrong == 0;
+		}
+	}
+
+	bool RunJobSystemStressTest()
+	{
+		constexpr size_t dequeItemCount = 1 << 20;
+		constexpr size_t rootJobCount = 1 << 16;
+		// At least four threads, on fewer cores the threads still interleave through preemption
+		size_t threadCount = (std::max)(std::thread::hardware_concurrency(), 4u);
+
+		std::cout << "JobSystem stress (" << dequeItemCount << " deque items, " << rootJobCount << " root jobs)\n";
+		std::cout << std::format("{:<20} {:>8} {:>8}\n", "test", "threads", "result");
+
+		bool passed = true;
+		for (size_t thieves : { size_t(1), threadCount - 1 }) {
+			bool result = StressWorkStealingDeque(dequeItemCount, thieves);
+			std::cout << std::format("{:<20} {:>8} {:>8}\n", "WorkStealingDeque", thieves + 1, result ? "passed" : "FAILED");
+			passed &= result;
+		}
+		for (size_t threads : { size_t(1), size_t(2), threadCount }) {
+			bool result = StressJobSystem(threads, rootJobCount);
+			std::cout << std::format("{:<20} {:>8} {:>8}\n", "JobSystem", threads, result ? "passed" : "FAILED");
+			passed &= result;
+		}
+		IneptEngine::Core::JobSystem::GetInstance().SetThreadCount(0);
+		return passed;
+	}
+
+	void RunJobSystemBenchmark()
+	{
+		using IneptEngine::Core::JobSystem;
+		using IneptEngine::Core::JobCounter;
+
+		constexpr size_t elementCount = 1 << 20;
+		constexpr size_t emptyJobCount = 100000;
+		constexpr int repetitions = 5;
+
+		JobSystem& jobs = JobSystem::GetInstance();
+		size_t hardwareThreads = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+		// Thread counts double up to the number of hardware threads, which is always measured last
+		std::vector<size_t> threadCounts;
+		for (size_t threads = 1; threads < hardwareThreads; threads *= 2) {
+			threadCounts.push_back(threads);
+		}
+		threadCounts.push_back(hardwareThreads);
+
+		std::cout << "JobSystem scaling (" << elementCount << " elements, best of " << repetitions << " runs)\n";
+		std::cout << std::format("{:>8} {:>16} {:>8} {:>18} {:>8} {:>18}\n", "threads", "ParallelFor ms", "speedup", "ParallelReduce ms", "speedup", "ns per empty job");
+
+		std::vector<float> values(elementCount);
+		double forBaseline = 0.0;
+		double reduceBaseline = 0.0;
+		for (size_t threads : threadCounts) {
+			jobs.SetThreadCount(threads);
+
+			// Enough arithmetic per element that the loop is bound by the cores rather than by memory bandwidth
+			double forTime = std::numeric_limits<double>::max();
+			double reduceTime = std::numeric_limits<double>::max();
+			double sum = 0.0;
+			for (int repetition = 0; repetition < repetitions; repetition++) {
+				forTime = (std::min)(forTime, MeasureNanoseconds([&]() {
+					jobs.ParallelFor(elementCount, [&values](size_t index) {
+						float x = static_cast<float>(index);
+						for (int i = 0; i < 16; i++) {
+							x = std::sqrt(x * 1.0001f + 1.0f);
+						}
+						values[index] = x;
+						}, 1024);
+					}));
+
+				reduceTime = (std::min)(reduceTime, MeasureNanoseconds([&]() {
+					sum = jobs.ParallelReduce(elementCount, 0.0,
+						[&values](size_t index) { return static_cast<double>(std::sin(values[index])); },
+						[](double left, double right) { return left + right; }, 1024);
+					}));
+			}
+
+			JobCounter counter;
+			double emptyTime = MeasureNanoseconds([&]() {
+				for (size_t i = 0; i < emptyJobCount; i++) {
+					jobs.Submit([]() {}, &counter);
+				}
+				jobs.Wait(counter);
+				});
+
+			if (threads == 1) {
+				forBaseline = forTime;
+				reduceBaseline = reduceTime;
+			}
+			std::cout << std::format("{:>8} {:>16.3f} {:>8.2f} {:>18.3f} {:>8.2f} {:>18.1f} (sum {:.3f})\n", threads,
+				forTime / 1e6, forBaseline / forTime, reduceTime / 1e6, reduceBaseline / reduceTime, emptyTime / emptyJobCount, sum);
+		}
+
+		jobs.SetThreadCount(0);
+	}
+} // namespace IneptBenchmark
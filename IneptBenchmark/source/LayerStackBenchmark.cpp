@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+
+#include <Core/LayerStack.h>
+
+namespace IneptBenchmark {
+	namespace {
+		class WorkingLayer : public IneptEngine::Core::Layer {
+		public:
+			WorkingLayer(uint32_t phases, int eventCategories, bool handlesEvents)
+				: Layer(phases, eventCategories), m_handlesEvents(handlesEvents) {}
+
+			virtual void OnUpdate(float deltaTime) override { m_time += deltaTime; }
+			virtual void OnRender(float alpha, IneptEngine::Rendering::RenderFrame& frame) override { m_time += alpha; }
+			virtual bool OnEvent(IneptEngine::Events::Event* event) override {
+				m_events++;
+				return m_handlesEvents;
+			}
+
+		private:
+			float m_time = 0.0f;
+			uint64_t m_events = 0;
+			bool m_handlesEvents;
+		};
+
+		// A layer that implements none of the hooks, like a layer that only does its work in OnAttach
+		class IdleLayer : public IneptEngine::Core::Layer {
+		public:
+			explicit IdleLayer(uint32_t phases) : Layer(phases) {}
+		};
+	}
+
+	void RunLayerStackBenchmark()
+	{
+		using namespace IneptEngine::Core;
+		using namespace IneptEngine::Events;
+
+		constexpr int frames = 100000;
+		constexpr int layerCount = 64;
+		constexpr int workingLayerCount = 4;
+
+		std::cout << "LayerStack dispatch (" << layerCount << " layers, " << workingLayerCount << " doing work, " << frames << " frames of an update, a render and 3 events)\n";
+		std::cout << std::format("{:>12} {:>12}\n", "layers", "ns/frame");
+
+		IneptEngine::Rendering::RenderFrame renderFrame;
+		AppTickEvent tick;
+		MouseMovedEvent mouseMoved(1.0f, 2.0f);
+		KeyPressedEvent keyPressed(IneptEngine::Input::Keyboard::KEY_ESCAPE, IneptEngine::Input::Keyboard::KeyModifier::None);
+		std::array<Event*, 3> events = { &tick, &mouseMoved, &keyPressed };
+
+		// Declared hooks and categories, or every layer in every phase as the stack used to dispatch
+		for (bool declared : { false, true }) {
+			LayerStack stack;
+			for (int i = 0; i < layerCount - workingLayerCount; i++) {
+				stack.PushLayer(new IdleLayer(declared ? 0u : static_cast<uint32_t>(Layer::AllPhases)));
+			}
+			for (int i = 0; i < workingLayerCount; i++) {
+				// The top overlay takes keyboard input, like a console
+				bool console = i == workingLayerCount - 1;
+				int categories = console ? EventCategory::Keyboard : EventCategory::Input;
+				stack.PushOverlay(new WorkingLayer(Layer::AllPhases, declared ? categories : ALL_CATEGORIES, console));
+			}
+
+			double time = MeasureNanoseconds([&]() {
+				for (int frame = 0; frame < frames; frame++) {
+					stack.OnUpdate(0.016f);
+					stack.OnRender(1.0f, renderFrame);
+					for (Event* event : events) {
+						stack.OnEvent(event);
+					}
+				}
+				});
+
+			std::cout << std::format("{:>12} {:>12.1f}\n", declared ? "declared" : "all", time / frames);
+		}
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,54 @@
+#include "Benchmark.h"
+
+#include <Core/MemoryTracker.h>
+
+namespace IneptBenchmark {
+	namespace {
+		struct Block {
+			std::byte data[64];
+		};
+
+		constexpr int batchSize = 1024;
+		constexpr int batches = 1000;
+
+		// Allocates and frees batches of blocks, keeping a batch alive so the pairs cannot be folded away
+		template<typename Allocate, typename Free>
+		double MeasureBatches(Allocate&& allocate, Free&& free) {
+			std::vector<void*> blocks(batchSize);
+			double time = MeasureNanoseconds([&]() {
+				for (int batch = 0; batch < batches; batch++) {
+					for (void*& block : blocks) {
+						block = allocate();
+					}
+					for (void* block : blocks) {
+						free(block);
+					}
+				}
+				});
+			return time / (static_cast<double>(batches) * batchSize);
+		}
+	}
+
+	void RunMemoryTrackerBenchmark()
+	{
+		using namespace IneptEngine::Core;
+
+		std::cout << "MemoryTracker (" << sizeof(Block) << " byte blocks, " << batches << " batches of " << batchSize << ", tracking "
+			<< (MemoryTracker::IsEnabled() ? "on" : "off") << ")\n";
+		std::cout << std::format("{:<16} {:>12}\n", "allocation", "ns/pair");
+
+		double time = MeasureBatches([]() { return std::malloc(sizeof(Block)); }, [](void* block) { std::free(block); });
+		std::cout << std::format("{:<16} {:>12.1f}\n", "malloc/free", time);
+
+		time = MeasureBatches([]() { return new Block(); }, [](void* block) { delete static_cast<Block*>(block); });
+		std::cout << std::format("{:<16} {:>12.1f}\n", "new/delete", time);
+
+		time = MeasureBatches([]() { MEMORY_TAG_SCOPE(Events); return new Block(); }, [](void* block) { delete static_cast<Block*>(block); });
+		std::cout << std::format("{:<16} {:>12.1f}\n", "tagged", time);
+
+		MemoryTracker::SetCallSiteCapture(true);
+		time = MeasureBatches([]() { return INEPT_NEW(Events) Block(); }, [](void* block) { delete static_cast<Block*>(block); });
+		MemoryTracker::SetCallSiteCapture(false);
+		std::cout << std::format("{:<16} {:>12.1f}\n", "call site", time);
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,40 @@
+#include "Benchmark.h"
+
+#include <Core/Profiler.h>
+
+namespace IneptBenchmark {
+	void RunProfilerBenchmark()
+	{
+		using IneptEngine::Core::Profiler;
+
+		constexpr int zones = 50000;
+
+		std::cout << "Profiler zones (" << zones << " zones per run)\n";
+#ifndef INEPT_ENABLE_PROFILER
+		std::cout << "Profiler benchmark skipped, the zones are compiled out\n";
+#else
+		std::cout << std::format("{:>12} {:>12}\n", "state", "ns/zone");
+
+		volatile int sink = 0;
+		auto recordZones = [&sink]() {
+			for (int i = 0; i < zones; i++) {
+				PROFILE_SCOPE("ProfilerBenchmark");
+				sink = sink + 1;
+			}
+			};
+
+		double idleTime = MeasureNanoseconds(recordZones);
+
+		// One frame is captured, the trace is written when the next frame starts
+		std::string path = "ProfilerBenchmark.json";
+		Profiler::CaptureFrames(1, path);
+		Profiler::BeginFrame();
+		double capturingTime = MeasureNanoseconds(recordZones);
+		Profiler::BeginFrame();
+
+		std::cout << std::format("{:>12} {:>12.2f}\n", "idle", idleTime / zones);
+		std::cout << std::format("{:>12} {:>12.2f}\n", "capturing", capturingTime / zones);
+		std::remove(path.c_str());
+#endif
+	}
+} // namespace IneptBenchmark
@@ -0,0 +1,70 @@
+#include "Benchmark.h"
+
+#include <Rendering/Renderer.h>
+
+namespace IneptBenchmark {
+	namespace {
+		// Busy waits, standing in for CPU work so the threads really compete for cores
+		void Spin(std::chrono::microseconds duration)
+		{
+			auto end = BenchmarkClock::now() + duration;
+			while (BenchmarkClock::now() < end) {
+			}
+		}
+
+		// Draws without a window or rendering context, every frame costs a fixed amount of CPU time
+		class SpinRenderer : public IneptEngine::Rendering::Renderer {
+		public:
+			explicit SpinRenderer(std::chrono::microseconds drawTime) : Renderer(nullptr), m_drawTime(drawTime) {}
+
+			~SpinRenderer() override {
+				SetPipelined(false);
+			}
+
+		protected:
+			void DrawFrame(IneptEngine::Rendering::RenderFrame& frame) override {
+				frame.ExecuteCommands();
+				Spin(m_drawTime);
+			}
+
+		private:
+			std::chrono::microseconds m_drawTime;
+		};
+	}
+
+	void RunRenderPipelineBenchmark()
+	{
+		using namespace std::chrono_literals;
+
+		constexpr int frames = 200;
+		const std::array<std::pair<std::chrono::microseconds, std::chrono::microseconds>, 3> workloads = { {
+			{ 4000us, 4000us },
+			{ 6000us, 2000us },
+			{ 2000us, 6000us },
+		} };
+
+		std::cout << "Render pipeline (" << frames << " frames, simulated update and draw work)\n";
+		std::cout << std::format("{:>10} {:>10} {:>16} {:>18} {:>8}\n", "update us", "draw us", "serial ms/frame", "pipelined ms/frame", "speedup");
+
+		for (const auto& [updateTime, drawTime] : workloads) {
+			double frameTimes[2];
+			for (int pipelined = 0; pipelined < 2; pipelined++) {
+				SpinRenderer renderer(drawTime);
+				renderer.SetPipelined(pipelined == 1);
+
+				frameTimes[pipelined] = MeasureNanoseconds([&]() {
+					for (int frame = 0; frame < frames; frame++) {
+						Spin(updateTime);
+						int value = frame;
+						renderer.GetFrame().Submit([value]() { (void)value; });
+						renderer.Render();
+					}
+					renderer.SetPipelined(false);
+					}) / frames;
+			}
+
+			std::cout << std::format("{:>10} {:>10} {:>16.3f} {:>18.3f} {:>8.2f}\n", updateTime.count(), drawTime.count(),
+				frameTimes[0] / 1e6, frameTimes[1] / 1e6, frameTimes[0] / frameTimes[1]);
+		}
+	}
+} // namespace IneptBenchmark
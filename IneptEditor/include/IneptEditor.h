@@ -11,7 +11,9 @@ namespace IneptEditor {
 	class EditorLayer : public IneptEngine::Core::Layer
 	{
 	public:
-		
+		// The editor does not handle events yet, override OnEvent and add EventPhase once it does
+		EditorLayer() : Layer(UpdatePhase | RenderPhase) {}
+
 		virtual void OnAttach() override {
 			LOG_DEBUG("Attach");
 		}
@@ -24,13 +26,9 @@ namespace IneptEditor {
 			LOG_DEBUG("Update");
 		}
 
-		virtual void OnRender() override {
+		virtual void OnRender(float alpha, IneptEngine::Rendering::RenderFrame& frame) override {
 			LOG_DEBUG("Render");
 		}
-
-		virtual void OnEvent(IneptEngine::Events::Event* event) override {
-			//LOG_DEBUG("{}", event->ToString());
-		}
 	};
 
 	/**
@@ -3,6 +3,10 @@
 #include <iepch.h>
 #include <IneptEngine.h>
 #include <Core/LayerStack.h>
+#include <Core/Timestep.h>
+#include <Core/FramePacer.h>
+#include <Core/FrameAllocator.h>
+#include <Core/FrameStats.h>
 
 #include <Windowing/Window.h>
 using namespace IneptEngine::Windowing;
@@ -41,6 +45,34 @@ namespace IneptEngine::Core {
 		const char* operator[](int index) const {
 			return Args[index];
 		}
+
+		/**
+		 * @brief Checks if an option was passed, e.g --headless
+		 * @param name The name of the option, including its dashes
+		 * @return True if the option is one of the arguments
+		 */
+		bool HasOption(std::string_view name) const {
+			for (int i = 1; i < Count; i++) {
+				if (name == Args[i]) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Gets the value following an option, e.g the path in --replay session.iej
+		 * @param name The name of the option, including its dashes
+		 * @return The argument after the option, or a null pointer if the option or its value is missing
+		 */
+		const char* GetOptionValue(std::string_view name) const {
+			for (int i = 1; i + 1 < Count; i++) {
+				if (name == Args[i]) {
+					return Args[i + 1];
+				}
+			}
+			return nullptr;
+		}
 	};
 
 	/**
@@ -59,14 +91,105 @@ namespace IneptEngine::Core {
 		Application(CommandLineArgs args) {
 			//InitLua();
 
-			LOG_INFO("Application started at {}", TIME_NOW);
+			LOG_INFO("Application started at {}", Core::Clock::FormatTime(TIME_NOW));
+			Profiler::SetThreadName("Main thread");
 
-			EVENT_SUBSCRIBE(WindowClose, [this](IneptEngine::Events::Event* e) {
+			m_windowCloseSubscription = EVENT_SUBSCRIBE(WindowClose, [this](IneptEngine::Events::Event* e) {
 				m_exit = true;
 				});
 
-			m_window = Window::CreateIneptWindow(nullptr, 800, 600, "Inept Window");
-			m_window->CreateRenderer(RenderingAPI::OpenGL);
+			// Frames are throttled while the window is minimized or in the background
+			m_windowStateSubscriptions[0] = EVENT_SUBSCRIBE(WindowMinimized, [this](IneptEngine::Events::Event* e) { m_minimized = true; });
+			m_windowStateSubscriptions[1] = EVENT_SUBSCRIBE(WindowRestored, [this](IneptEngine::Events::Event* e) { m_minimized = false; });
+			m_windowStateSubscriptions[2] = EVENT_SUBSCRIBE(WindowFocus, [this](IneptEngine::Events::Event* e) { m_focused = true; });
+			m_windowStateSubscriptions[3] = EVENT_SUBSCRIBE(WindowLostFocus, [this](IneptEngine::Events::Event* e) { m_focused = false; });
+
+			m_layerEventSubscription = IneptEngine::Events::EventBus::GetInstance().Subscribe(ALL_CATEGORIES, [this](Events::Event* e) {
+				m_layerStack.OnEvent(e);
+				}, this);
+			IneptEngine::Events::EventBus::GetInstance().SetSubscriptionName(m_layerEventSubscription.GetHandle(), "LayerStack::OnEvent");
+
+			// --headless runs without a window or rendering context, the only option on platforms without a window yet
+			m_headless = args.HasOption("--headless");
+			if (!m_headless) {
+				m_window = Window::CreateIneptWindow(nullptr, 800, 600, "Inept Window");
+				if (m_window == nullptr) {
+					LOG_WARNING("Windows are not supported on this platform, running headless");
+					m_headless = true;
+				}
+			}
+			if (m_headless) {
+				m_window = Window::CreateHeadlessWindow(nullptr, 800, 600, "Inept Window");
+				m_window->CreateRenderer(RenderingAPI::Null);
+			}
+			else {
+				m_window->CreateRenderer(RenderingAPI::OpenGL);
+			}
+
+			// --frames exits after the given number of frames
+			if (const char* frames = args.GetOptionValue("--frames")) {
+				m_frameLimit = static_cast<uint64_t>(std::atoll(frames));
+			}
+
+			// --dt makes every frame advance the simulation by the given number of seconds, however long it took
+			if (const char* frameTime = args.GetOptionValue("--dt")) {
+				m_frameClock.SetFixedFrameTime(std::atof(frameTime));
+			}
+
+			// --record writes every event to a journal, --replay feeds a journal back in place of window and OS input
+			if (const char* journal = args.GetOptionValue("--record")) {
+				IneptEngine::Events::EventBus::GetInstance().StartRecording(journal);
+			}
+			else if (const char* journal = args.GetOptionValue("--replay")) {
+				m_replaying = IneptEngine::Events::EventBus::GetInstance().StartReplay(journal);
+			}
+
+			// --event-stats logs event latency and handler timings every given number of seconds
+			if (const char* interval = args.GetOptionValue("--event-stats")) {
+				IneptEngine::Events::EventBus::GetInstance().SetStatsDumpInterval(std::chrono::milliseconds(static_cast<int64_t>(std::atof(interval) * 1000.0)));
+			}
+
+			// --tick-rate runs the simulation in fixed steps of the given rate in Hz
+			if (const char* tickRate = args.GetOptionValue("--tick-rate")) {
+				SetFixedTimestep(std::atof(tickRate));
+			}
+
+			// --job-threads sets the threads running jobs, 1 runs every job on the thread submitting it for debugging,
+			// either way the main thread is worker zero and runs jobs while it waits for them
+			if (const char* jobThreads = args.GetOptionValue("--job-threads")) {
+				JobSystem::GetInstance().SetThreadCount(static_cast<size_t>(std::atoi(jobThreads)));
+			}
+			else {
+				JobSystem::GetInstance().SetMainThread();
+			}
+
+			// --pipelined-render draws frames on a render thread while the next frame is simulated
+			if (args.HasOption("--pipelined-render")) {
+				SetPipelinedRendering(true);
+			}
+
+			// --profile captures the given number of frames into a Chrome trace, --profile-output sets the file
+			if (const char* frames = args.GetOptionValue("--profile")) {
+				const char* output = args.GetOptionValue("--profile-output");
+				Profiler::CaptureFrames(static_cast<uint32_t>(std::atoi(frames)), output != nullptr ? output : "IneptProfile.json");
+			}
+
+			// --memory-call-sites counts the memory of INEPT_NEW per call site, --memory-diff logs the growth every given number of frames
+			if (args.HasOption("--memory-call-sites")) {
+				MemoryTracker::SetCallSiteCapture(true);
+			}
+			if (const char* frames = args.GetOptionValue("--memory-diff"); frames != nullptr && !MemoryTracker::IsEnabled()) {
+				LOG_WARNING("--memory-diff needs a build with INEPT_ENABLE_MEMORY_TRACKING");
+			}
+			else if (frames != nullptr) {
+				m_memoryDiffInterval = static_cast<uint64_t>(std::atoll(frames));
+				m_memorySnapshot = MemoryTracker::TakeSnapshot();
+			}
+
+			// --fps caps the frame rate
+			if (const char* frameRate = args.GetOptionValue("--fps")) {
+				SetTargetFrameRate(std::atof(frameRate));
+			}
 		}
 
 		/**
@@ -75,42 +198,164 @@ namespace IneptEngine::Core {
 		 * This destructor cleans up any resources used by the Application object.
 		 */
 		virtual ~Application() {
+			FrameTimeStats frames = m_frameTimes.GetStats();
+			if (frames.frameCount != 0) {
+				LOG_INFO("Frame times: {} frames in {:.3f} s, {:.1f} fps, mean {:.3f} ms, p50 {:.3f} ms, p99 {:.3f} ms, min {:.3f} ms, max {:.3f} ms",
+					frames.frameCount, frames.totalTime / 1e9, frames.frameCount * 1e9 / frames.totalTime, frames.meanFrameTime / 1e6,
+					frames.p50 / 1e6, frames.p99 / 1e6, frames.minFrameTime / 1e6, frames.maxFrameTime / 1e6);
+			}
+
+			FramePacingStats pacing = m_framePacer.GetStats();
+			if (pacing.frameCount != 0) {
+				LOG_INFO("Frame pacing: {} frames, target {:.3f} ms, mean {:.3f} ms, jitter p50 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms",
+					pacing.frameCount, pacing.targetFrameTime / 1e6, pacing.meanFrameTime / 1e6, pacing.jitterP50 / 1e6, pacing.jitterP99 / 1e6, pacing.jitterMax / 1e6);
+			}
+
+			FrameAllocatorStats frameMemory = FrameAllocator::GetStats();
+			LOG_INFO("Frame memory: {} threads, last frame {} bytes, high-water mark {} bytes, {} bytes reserved, {} heap allocations",
+				frameMemory.threadCount, frameMemory.lastFrameBytes, frameMemory.peakFrameBytes, frameMemory.reservedBytes, frameMemory.heapAllocations);
+
+			IneptEngine::Events::EventBus::GetInstance().StopRecording();
+
+			// The render thread draws into the window, it is stopped before the window goes away
+			m_window->GetRenderer()->SetPipelined(false);
 			delete m_window;
 
 			//CloseLua();
+
+			// Whatever is still alive here is held by statics or leaked
+			if (MemoryTracker::IsEnabled()) {
+				MemoryTracker::Log(MemoryTracker::TakeSnapshot(), "at exit");
+			}
 		}
 
 		/**
 		 * @fn void Run()
 		 * @brief Runs the Application object
 		 * This function is the main loop of the Application object, which should continue until the application is closed.
+		 *
+		 * Every simulation step dispatches an AppTickEvent to the subscribers right away and then updates the layers, once per
+		 * frame with the frame time in variable-step mode, or as many fixed steps as the frame time adds up to in fixed-step
+		 * mode, so each step sees its own tick before the queued events are processed at the end of the frame. The layers then
+		 * record the frame, which is drawn right away or, with pipelined rendering, during the next frame's update.
 		 */
 		virtual int Run() {
 			while (!m_exit)
 			{
+				// Memory allocated from the frame allocators two frames ago is reclaimed from here on
+				FrameAllocator::BeginFrame();
+				MemoryTracker::BeginFrame();
+				Profiler::BeginFrame();
+				PROFILE_SCOPE("Application::Run");
+
+				Clock::Ticks frameStart = Clock::Now();
+				double frameTime = m_frameClock.Tick();
+
 				EVENT_PUBLISH(AppUpdateEvent);
 
-				m_layerStack.OnUpdate(1);//Need to add timestep
+				float alpha = 1.0f;
+				if (m_timestepMode == TimestepMode::Fixed) {
+					uint32_t steps = m_fixedTimestep.Advance(frameTime);
+					float stepTime = static_cast<float>(m_fixedTimestep.GetStepTime());
+					for (uint32_t step = 0; step < steps; step++) {
+						EVENT_PUBLISH_NOW(AppTickEvent);
+						m_layerStack.OnUpdate(stepTime);
+					}
+					alpha = m_fixedTimestep.GetAlpha();
+				}
+				else {
+					EVENT_PUBLISH_NOW(AppTickEvent);
+					m_layerStack.OnUpdate(static_cast<float>(frameTime));
+				}
+
+				// The layers record the frame before the window draws it, or hands it to the render thread when pipelined
+				Rendering::RenderFrame& frame = m_window->GetRenderer()->GetFrame();
+				frame.alpha = alpha;
+				m_layerStack.OnRender(alpha, frame);
 
 				m_window->Update();
 
-				IneptEngine::Events::EventBus::GetInstance().Subscribe(ALL_CATEGORIES, std::bind([this](Events::Event* e) {
-					m_layerStack.OnEvent(e);
-					}, std::placeholders::_1));
+				EVENT_PROCESS();
 
-				m_layerStack.OnRender();
+				// A replayed session ends with the journal
+				if (m_replaying && !IneptEngine::Events::EventBus::GetInstance().IsReplaying()) {
+					m_exit = true;
+				}
 
-				EVENT_PROCESS();
+				// The time spent on the frame, without waiting for the next one
+				m_frameTimes.Record(Clock::ElapsedNanoseconds(frameStart, Clock::Now()));
+				if (m_frameLimit != 0 && m_frameTimes.GetFrameCount() >= m_frameLimit) {
+					m_exit = true;
+				}
+
+				if (m_memoryDiffInterval != 0 && m_frameTimes.GetFrameCount() % m_memoryDiffInterval == 0) {
+					MemorySnapshot snapshot = MemoryTracker::TakeSnapshot();
+					MemoryTracker::Log(snapshot.Diff(m_memorySnapshot), std::format("growth over the last {} frames", m_memoryDiffInterval));
+					m_memorySnapshot = std::move(snapshot);
+				}
+
+				PaceFrame();
 			}
 			return 1;
 		}
 
 	private:
 		bool m_exit = false;
+		bool m_replaying = false;
+		bool m_headless = false;
+
+		// Number of frames to run before exiting, zero to run until the window is closed
+		uint64_t m_frameLimit = 0;
+		FrameTimeRecorder m_frameTimes;
+
+		// Number of frames between two logs of the memory growth, zero for none, and the snapshot the next log is taken against
+		uint64_t m_memoryDiffInterval = 0;
+		MemorySnapshot m_memorySnapshot;
+
+		FrameClock m_frameClock;
+		TimestepMode m_timestepMode = TimestepMode::Variable;
+		FixedTimestep m_fixedTimestep;
+
+		// Frame rate used while the window is in the background, and the longest wait for OS events while it is minimized
+		static constexpr double BackgroundFrameRate = 30.0;
+		static constexpr std::chrono::milliseconds MinimizedWaitTime{ 100 };
+
+		FramePacer m_framePacer;
+		double m_targetFrameRate = 0.0;
+		bool m_minimized = false;
+		bool m_focused = true;
+
+		/**
+		 * @brief Waits until the next frame should start
+		 *
+		 * A minimized window blocks until the OS has an event for it, waking up regularly so timers and events from other
+		 * threads are still processed. A window in the background is capped at BackgroundFrameRate, otherwise frames
+		 * are paced to the target frame rate.
+		 */
+		void PaceFrame()
+		{
+			if (m_minimized) {
+				m_window->GetInputManager()->WaitForEvents(MinimizedWaitTime);
+				m_framePacer.Skip();
+				return;
+			}
 
-		IneptEngine::Windowing::Window* m_window;
+			double frameRate = m_targetFrameRate;
+			if (!m_focused && (frameRate == 0.0 || frameRate > BackgroundFrameRate)) {
+				frameRate = BackgroundFrameRate;
+			}
+			m_framePacer.SetTargetFrameRate(frameRate);
+			m_framePacer.WaitForNextFrame();
+		}
+
+		IneptEngine::Windowing::Window* m_window = nullptr;
 		LayerStack m_layerStack;
 
+		// Declared after the members their handlers use, so they unsubscribe first
+		IneptEngine::Events::SubscriptionToken m_windowCloseSubscription;
+		IneptEngine::Events::SubscriptionToken m_layerEventSubscription;
+		std::array<IneptEngine::Events::SubscriptionToken, 4> m_windowStateSubscriptions;
+
 	protected:
 		void PushLayer(Layer* layer)
 		{
@@ -121,6 +366,72 @@ namespace IneptEngine::Core {
 		{
 			m_layerStack.PushOverlay(overlay);
 		}
+
+		/**
+		 * @brief Updates the layers once per frame with the measured frame time, the default
+		 */
+		void SetVariableTimestep()
+		{
+			m_timestepMode = TimestepMode::Variable;
+		}
+
+		/**
+		 * @brief Updates the layers in fixed steps, independent of the frame rate
+		 * @param tickRate The number of steps per second
+		 * @param maxCatchUpSteps The largest number of steps run in one frame, time beyond it is dropped
+		 */
+		void SetFixedTimestep(double tickRate, uint32_t maxCatchUpSteps = 5)
+		{
+			m_timestepMode = TimestepMode::Fixed;
+			m_fixedTimestep.SetTickRate(tickRate);
+			m_fixedTimestep.SetMaxCatchUpSteps(maxCatchUpSteps);
+		}
+
+		/**
+		 * @brief Draws frames on a render thread that owns the rendering context, while the main thread simulates the next frame
+		 *
+		 * A frame then takes about as long as the slower of updating and drawing rather than both, and is shown one
+		 * frame later. Layers must only record into the RenderFrame passed to OnRender.
+		 *
+		 * @param pipelined True to draw on a render thread, false to draw on the main thread
+		 */
+		void SetPipelinedRendering(bool pipelined)
+		{
+			m_window->GetRenderer()->SetPipelined(pipelined);
+		}
+
+		/**
+		 * @brief Caps the frame rate, frames are paced by sleeping and then spinning until they are due
+		 * @param frameRate The frames per second, zero for no cap
+		 */
+		void SetTargetFrameRate(double frameRate)
+		{
+			m_targetFrameRate = frameRate;
+		}
+
+		/**
+		 * @brief Gets the frame times and jitter measured by the frame pacer
+		 */
+		FramePacingStats GetFramePacingStats() const
+		{
+			return m_framePacer.GetStats();
+		}
+
+		/**
+		 * @brief Checks if the application runs without a window, see --headless
+		 */
+		bool IsHeadless() const
+		{
+			return m_headless;
+		}
+
+		/**
+		 * @brief Gets how the layers are updated every frame
+		 */
+		TimestepMode GetTimestepMode() const
+		{
+			return m_timestepMode;
+		}
 	};
 
 	/**
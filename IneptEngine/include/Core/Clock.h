@@ -0,0 +1,126 @@
+#pragma once
+
+#include <iepch.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define INEPT_CLOCK_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace IneptEngine::Core {
+	/**
+	 * @class Clock
+	 * @brief Monotonic high-resolution engine clock shared by events, logs and profiling
+	 *
+	 * Timestamps are 64-bit tick counts. On x86 CPUs whose time stamp counter is invariant a tick is a cycle of it, so
+	 * reading the clock is a single instruction. Elsewhere, including CPUs whose counter changes rate with the power state
+	 * or stops in sleep states, a tick is a nanosecond of std::chrono::steady_clock. The length of a tick is
+	 * calibrated against steady_clock the first time ticks are converted, and ticks are only turned into wall-clock time
+	 * when text is produced.
+	 */
+	class Clock {
+	public:
+		using Ticks = uint64_t;
+
+		/**
+		 * @brief Reads the clock
+		 * @return The current tick count
+		 */
+		static Ticks Now() {
+#ifdef INEPT_CLOCK_TSC
+			if (IsUsingTimeStampCounter()) {
+				return __rdtsc();
+			}
+#endif
+			return static_cast<Ticks>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		/**
+		 * @brief Checks if ticks are cycles of the time stamp counter rather than nanoseconds of steady_clock
+		 *
+		 * The CPU is queried once, the first time the clock is read.
+		 */
+		static bool IsUsingTimeStampCounter() {
+#ifdef INEPT_CLOCK_TSC
+			static const bool usingTimeStampCounter = HasInvariantTimeStampCounter();
+			return usingTimeStampCounter;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * @brief Converts a number of ticks to nanoseconds
+		 * @param ticks The number of ticks, e.g the difference of two timestamps
+		 * @return The number of nanoseconds
+		 */
+		static uint64_t ToNanoseconds(Ticks ticks) {
+			return static_cast<uint64_t>(static_cast<double>(ticks) * GetCalibration().nanosecondsPerTick);
+		}
+
+		/**
+		 * @brief Converts a number of nanoseconds to ticks
+		 * @param nanoseconds The number of nanoseconds
+		 * @return The number of ticks
+		 */
+		static Ticks FromNanoseconds(uint64_t nanoseconds) {
+			return static_cast<Ticks>(static_cast<double>(nanoseconds) / GetCalibration().nanosecondsPerTick);
+		}
+
+		/**
+		 * @brief Gets the number of nanoseconds between two timestamps, zero if the end is before the start
+		 * @param start The earlier timestamp
+		 * @param end The later timestamp
+		 */
+		static uint64_t ElapsedNanoseconds(Ticks start, Ticks end) {
+			return end > start ? ToNanoseconds(end - start) : 0;
+		}
+
+		/**
+		 * @brief Gets the number of ticks per second
+		 */
+		static double GetTicksPerSecond() {
+			return 1e9 / GetCalibration().nanosecondsPerTick;
+		}
+
+		/**
+		 * @brief Converts a timestamp to wall-clock time
+		 * @param timestamp The timestamp
+		 * @return The system time the timestamp was taken at
+		 */
+		static std::chrono::system_clock::time_point ToSystemTime(Ticks timestamp);
+
+		/**
+		 * @brief Formats a timestamp as local wall-clock time, e.g 14:03:27.512
+		 *
+		 * Looking up the time zone is done once per second and thread, the rest of the text is cached.
+		 *
+		 * @param timestamp The timestamp
+		 * @return The local time of day with milliseconds
+		 */
+		static std::string FormatTime(Ticks timestamp);
+
+	private:
+		struct Calibration {
+			Ticks startTicks;
+			std::chrono::system_clock::time_point startTime;
+			double nanosecondsPerTick;
+		};
+
+		/**
+		 * @brief Measures the length of a tick on first use
+		 */
+		static const Calibration& GetCalibration();
+
+#ifdef INEPT_CLOCK_TSC
+		/**
+		 * @brief Checks with CPUID if the time stamp counter runs at a constant rate in every power state
+		 */
+		static bool HasInvariantTimeStampCounter();
+#endif
+	};
+} // namespace IneptEngine::Core
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/ThreadNodeList.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class EpochDomain
+	 * @brief Epoch-based reclamation, tells a writer when memory that lock-free readers may still see can be freed
+	 *
+	 * Readers wrap every access to shared data in a ReadGuard, which publishes the global epoch the thread entered at.
+	 * A writer that unpublishes data calls Retire, which returns the epoch the data was retired in and advances the global
+	 * epoch, and frees the data once IsSafe reports that no reader that entered at or before that epoch is still reading.
+	 * Readers never wait and never take a lock, writers never wait for readers either, they just free later.
+	 *
+	 * Every reading thread is given a record the first time it reads, which is handed back when the thread exits, so the
+	 * domain must outlive every thread reading from it.
+	 */
+	class EpochDomain {
+		struct Record;
+
+	public:
+		/**
+		 * @class ReadGuard
+		 * @brief Marks the calling thread as reading for its lifetime, guards can be nested
+		 */
+		class [[nodiscard]] ReadGuard {
+		public:
+			/**
+			 * @brief Enters the domain
+			 * @param domain The domain to read from
+			 */
+			explicit ReadGuard(EpochDomain& domain) : m_record(domain.GetThreadRecord()) {
+				if (m_record->depth++ == 0) {
+					m_record->epoch.store(domain.m_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					// Pairs with the fence in Retire, either the writer sees this reader or the reader sees the new data
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			ReadGuard(const ReadGuard&) = delete;
+			ReadGuard& operator=(const ReadGuard&) = delete;
+
+			/**
+			 * @brief Leaves the domain once the outermost guard of the thread is destroyed
+			 */
+			~ReadGuard() {
+				if (--m_record->depth == 0) {
+					m_record->epoch.store(0, std::memory_order_release);
+				}
+			}
+
+		private:
+			Record* m_record;
+		};
+
+		EpochDomain() = default;
+		EpochDomain(const EpochDomain&) = delete;
+		EpochDomain& operator=(const EpochDomain&) = delete;
+
+		/**
+		 * @brief Frees the records of all threads that ever read from the domain
+		 */
+		~EpochDomain() {
+			m_records.DeleteNodes();
+		}
+
+		/**
+		 * @brief Marks data that was just unpublished as retired
+		 *
+		 * Must be called after the data was made unreachable for new readers.
+		 *
+		 * @return The epoch to pass to IsSafe before freeing the data
+		 */
+		uint64_t Retire() {
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			return m_epoch.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		/**
+		 * @brief Checks if data retired in an epoch can be freed
+		 * @param retiredEpoch The epoch returned by Retire
+		 * @return True if no reader that may still see the data is reading
+		 */
+		bool IsSafe(uint64_t retiredEpoch) const {
+			for (auto* node = m_records.GetFirst(); node != nullptr; node = node->next) {
+				uint64_t epoch = node->value.epoch.load(std::memory_order_seq_cst);
+				if (epoch != 0 && epoch <= retiredEpoch) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private:
+		struct Record {
+			// The epoch the thread entered at, zero while it is not reading
+			std::atomic<uint64_t> epoch = 0;
+
+			// Only touched by the thread owning the record
+			uint32_t depth = 0;
+		};
+
+		using RecordNode = ThreadNodeList<Record>::Node;
+
+		// Records of the calling thread, handed back when the thread exits
+		struct ThreadRecords {
+			std::vector<std::pair<const EpochDomain*, RecordNode*>> records;
+
+			~ThreadRecords() {
+				for (auto& [domain, node] : records) {
+					ThreadNodeList<Record>::Release(node);
+				}
+			}
+		};
+
+		/**
+		 * @brief Gets the record of the calling thread, reusing the record of an exited thread or adding one on the first read
+		 */
+		Record* GetThreadRecord() {
+			static thread_local ThreadRecords threadRecords;
+			for (auto& [domain, node] : threadRecords.records) {
+				if (domain == this) {
+					return &node->value;
+				}
+			}
+
+			RecordNode* node = m_records.Acquire();
+			threadRecords.records.emplace_back(this, node);
+			return &node->value;
+		}
+
+		std::atomic<uint64_t> m_epoch = 1;
+		ThreadNodeList<Record> m_records;
+	};
+} // namespace IneptEngine::Core
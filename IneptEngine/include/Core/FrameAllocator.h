@@ -0,0 +1,178 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @brief Frame memory used by all threads, the byte counts are summed over the threads
+	 */
+	struct FrameAllocatorStats {
+		uint64_t frameIndex;
+		size_t threadCount;
+		size_t lastFrameBytes;
+		size_t peakFrameBytes;
+		size_t reservedBytes;
+		uint64_t heapAllocations;
+	};
+
+	/**
+	 * @class FrameAllocator
+	 * @brief Per-thread linear allocator for memory that only lives for a frame
+	 *
+	 * Allocating bumps a pointer and freeing does nothing, all memory is reclaimed at once when the frame it was
+	 * allocated in is two frames old. Every thread has two arenas and switches to the other one, emptying it, on its
+	 * first allocation after the Application started a new frame, so memory allocated during a frame stays valid until
+	 * the end of the following frame, long enough for a render thread to draw the frame it was recorded for.
+	 *
+	 * An arena that runs out takes another block from the heap, and is rebuilt as a single block large enough for all
+	 * of them when it is emptied, so after a few frames temporary data no longer touches the heap at all.
+	 * Destructors are never run, only trivially destructible data or containers using GetMemoryResource belong here.
+	 */
+	class FrameAllocator {
+	public:
+		/**
+		 * @brief Size of the first block of every arena
+		 */
+		static constexpr size_t InitialBlockSize = 64 * 1024;
+
+		/**
+		 * @brief Gets the frame allocator of the calling thread
+		 */
+		static FrameAllocator& Get();
+
+		/**
+		 * @brief Starts a new frame on every thread, called by the Application at the start of each frame
+		 */
+		static void BeginFrame() { s_frameIndex.fetch_add(1, std::memory_order_relaxed); }
+
+		/**
+		 * @brief Gets the index of the current frame
+		 */
+		static uint64_t GetFrameIndex() { return s_frameIndex.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief Gets a memory resource allocating from the frame allocator of the calling thread, for std::pmr containers
+		 *
+		 * Containers using it must not outlive the following frame, and should be filled on one thread.
+		 */
+		static std::pmr::memory_resource* GetMemoryResource();
+
+		/**
+		 * @brief Gets the frame memory used by all threads
+		 */
+		static FrameAllocatorStats GetStats();
+
+		FrameAllocator(const FrameAllocator&) = delete;
+		FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+		/**
+		 * @brief Allocates memory that stays valid until the end of the next frame
+		 * @param size The number of bytes
+		 * @param alignment The alignment, a power of two
+		 * @return The memory, never a null pointer
+		 */
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+			uint64_t frame = s_frameIndex.load(std::memory_order_relaxed);
+			if (frame != m_frame) {
+				SwitchArena(frame);
+			}
+
+			// An arena without a block has a null cursor, even an empty allocation has to take a block first
+			Arena& arena = m_arenas[m_currentArena];
+			uintptr_t address = (reinterpret_cast<uintptr_t>(arena.cursor) + (alignment - 1)) & ~(alignment - 1);
+			if (arena.cursor != nullptr && address + size <= reinterpret_cast<uintptr_t>(arena.end)) {
+				arena.cursor = reinterpret_cast<std::byte*>(address + size);
+				return reinterpret_cast<void*>(address);
+			}
+			return AllocateBlock(size, alignment);
+		}
+
+		/**
+		 * @brief Allocates uninitialized memory for an array that stays valid until the end of the next frame
+		 * @param count The number of elements
+		 */
+		template<typename T>
+		T* Allocate(size_t count = 1) {
+			static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destroyed, T must be trivially destructible");
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		/**
+		 * @brief Gets the number of bytes the calling thread allocated in the current frame
+		 */
+		size_t GetUsedBytes() const {
+			const Arena& arena = m_arenas[m_currentArena];
+			return arena.fullBlockBytes + static_cast<size_t>(arena.cursor - arena.blockStart);
+		}
+
+	private:
+		struct Arena {
+			std::vector<std::pair<std::unique_ptr<std::byte[]>, size_t>> blocks;
+			std::byte* blockStart = nullptr;
+			std::byte* cursor = nullptr;
+			std::byte* end = nullptr;
+
+			// Bytes used in the blocks before the current one
+			size_t fullBlockBytes = 0;
+		};
+
+		FrameAllocator();
+		~FrameAllocator();
+
+		/**
+		 * @brief Ends the thread's frame and empties the other arena for the new one
+		 */
+		void SwitchArena(uint64_t frame);
+
+		/**
+		 * @brief Continues the current arena in a new block from the heap
+		 */
+		void* AllocateBlock(size_t size, size_t alignment);
+
+		/**
+		 * @brief Frees every block of an arena and gives it one block of at least the given size
+		 */
+		void ResetArena(Arena& arena, size_t size);
+
+		static inline std::atomic<uint64_t> s_frameIndex = 0;
+
+		std::array<Arena, 2> m_arenas;
+		size_t m_currentArena = 0;
+		uint64_t m_frame = 0;
+
+		// Read by GetStats from other threads
+		std::atomic<size_t> m_lastFrameBytes = 0;
+		std::atomic<size_t> m_peakFrameBytes = 0;
+		std::atomic<size_t> m_reservedBytes = 0;
+		std::atomic<uint64_t> m_heapAllocations = 0;
+	};
+
+	/**
+	 * @class FrameMemoryResource
+	 * @brief std::pmr adapter of the frame allocator, see FrameAllocator::GetMemoryResource
+	 */
+	class FrameMemoryResource : public std::pmr::memory_resource {
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			return FrameAllocator::Get().Allocate(bytes, alignment);
+		}
+
+		// Frame memory is reclaimed with its frame
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	};
+
+	/**
+	 * @brief A vector allocating from frame memory, e.g FrameVector<int> indices(FrameAllocator::GetMemoryResource())
+	 */
+	template<typename T>
+	using FrameVector = std::pmr::vector<T>;
+
+	/**
+	 * @brief A string allocating from frame memory
+	 */
+	using FrameString = std::pmr::string;
+} // namespace IneptEngine::Core
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/Clock.h>
+
+#if defined(INEPT_PLATFORM_WINDOWS) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace IneptEngine::Core {
+	/**
+	 * @brief How evenly the FramePacer has spaced frames, all times in nanoseconds
+	 *
+	 * Jitter is how far the time between two paced frames was from the target frame time, over the last frames.
+	 */
+	struct FramePacingStats {
+		uint64_t frameCount;
+		uint64_t targetFrameTime;
+		uint64_t meanFrameTime;
+		uint64_t jitterP50;
+		uint64_t jitterP99;
+		uint64_t jitterMax;
+	};
+
+	/**
+	 * @class FramePacer
+	 * @brief Caps the frame rate by waiting for the start of every frame
+	 *
+	 * Frames are scheduled a fixed period after the previous deadline rather than after the previous frame, so waits
+	 * do not drift. Waiting sleeps until shortly before the deadline and spins for the rest: the spin margin follows how
+	 * late the operating system wakes sleeping threads, so the deadline is hit within microseconds while most of the
+	 * wait is spent asleep. On Windows a high resolution waitable timer is used when available, plain sleeps there
+	 * are only accurate to the 15.6 ms system tick.
+	 */
+	class FramePacer {
+	public:
+		/**
+		 * @brief Number of recent frames the jitter percentiles are computed over
+		 */
+		static constexpr size_t JitterSampleCount = 1024;
+
+		FramePacer() {
+#ifdef INEPT_PLATFORM_WINDOWS
+			m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+		}
+
+		FramePacer(const FramePacer&) = delete;
+		FramePacer& operator=(const FramePacer&) = delete;
+
+		~FramePacer() {
+#ifdef INEPT_PLATFORM_WINDOWS
+			if (m_timer != nullptr) {
+				CloseHandle(m_timer);
+			}
+#endif
+		}
+
+		/**
+		 * @brief Sets the frame rate to pace to, changing it starts a new schedule from the next frame
+		 * @param frameRate The frames per second, zero to not wait at all
+		 */
+		void SetTargetFrameRate(double frameRate) {
+			if (frameRate == m_targetFrameRate) {
+				return;
+			}
+			m_targetFrameRate = frameRate;
+			m_period = frameRate > 0.0 ? Clock::FromNanoseconds(static_cast<uint64_t>(1e9 / frameRate)) : 0;
+			Skip();
+		}
+
+		/**
+		 * @brief Gets the frame rate frames are paced to, zero if they are not
+		 */
+		double GetTargetFrameRate() const { return m_targetFrameRate; }
+
+		/**
+		 * @brief Waits until the next frame is due, returns immediately if no frame rate is set
+		 */
+		void WaitForNextFrame() {
+			if (m_period == 0) {
+				return;
+			}
+
+			Clock::Ticks now = Clock::Now();
+			if (m_deadline == 0) {
+				m_deadline = now + m_period;
+				m_frameStart = now;
+				return;
+			}
+
+			// A frame that took longer than a whole period starts a new schedule instead of rushing the following frames
+			if (now > m_deadline + m_period) {
+				m_deadline = now;
+			}
+			WaitUntil(m_deadline);
+
+			Clock::Ticks frameStart = Clock::Now();
+			RecordFrame(Clock::ElapsedNanoseconds(m_frameStart, frameStart));
+			m_frameStart = frameStart;
+			m_deadline += m_period;
+		}
+
+		/**
+		 * @brief Starts a new schedule at the next call to WaitForNextFrame, for frames that were not paced
+		 */
+		void Skip() {
+			m_deadline = 0;
+		}
+
+		/**
+		 * @brief Gets the frame times and jitter measured since the last reset
+		 */
+		FramePacingStats GetStats() const {
+			FramePacingStats stats = {};
+			stats.frameCount = m_frameCount;
+			stats.targetFrameTime = m_period != 0 ? Clock::ToNanoseconds(m_period) : 0;
+			if (m_frameCount == 0) {
+				return stats;
+			}
+			stats.meanFrameTime = m_totalFrameTime / m_frameCount;
+
+			std::vector<uint64_t> jitter(m_jitter.begin(), m_jitter.begin() + (std::min)(m_frameCount, static_cast<uint64_t>(JitterSampleCount)));
+			std::sort(jitter.begin(), jitter.end());
+			stats.jitterP50 = jitter[jitter.size() / 2];
+			stats.jitterP99 = jitter[jitter.size() * 99 / 100];
+			stats.jitterMax = m_jitterMax;
+			return stats;
+		}
+
+		/**
+		 * @brief Clears the measured frame times
+		 */
+		void ResetStats() {
+			m_frameCount = 0;
+			m_totalFrameTime = 0;
+			m_jitterMax = 0;
+		}
+
+	private:
+		// Bounds of the time spun before a deadline, the sleep overshoot usually lies well inside
+		static constexpr uint64_t MinSpinNanoseconds = 100'000;
+		static constexpr uint64_t MaxSpinNanoseconds = 4'000'000;
+
+		/**
+		 * @brief Sleeps for most of the time left until a deadline and spins for the rest
+		 */
+		void WaitUntil(Clock::Ticks deadline) {
+			for (;;) {
+				Clock::Ticks sleepStart = Clock::Now();
+				uint64_t remaining = Clock::ElapsedNanoseconds(sleepStart, deadline);
+				if (remaining <= m_spinNanoseconds) {
+					break;
+				}
+
+				uint64_t requested = remaining - m_spinNanoseconds;
+				SleepFor(requested);
+
+				// The spin margin is twice the running average of how late sleeps wake up
+				uint64_t slept = Clock::ElapsedNanoseconds(sleepStart, Clock::Now());
+				double overshoot = slept > requested ? static_cast<double>(slept - requested) : 0.0;
+				m_sleepOvershoot += (overshoot - m_sleepOvershoot) / 8.0;
+				m_spinNanoseconds = std::clamp(static_cast<uint64_t>(2.0 * m_sleepOvershoot), MinSpinNanoseconds, MaxSpinNanoseconds);
+			}
+
+			while (Clock::Now() < deadline) {
+#ifdef INEPT_CLOCK_TSC
+				_mm_pause();
+#else
+				std::this_thread::yield();
+#endif
+			}
+		}
+
+		/**
+		 * @brief Blocks the thread for about the given time
+		 */
+		void SleepFor(uint64_t nanoseconds) {
+#ifdef INEPT_PLATFORM_WINDOWS
+			if (m_timer != nullptr) {
+				// Negative due times are relative, in units of 100 ns
+				LARGE_INTEGER dueTime;
+				dueTime.QuadPart = -static_cast<LONGLONG>(nanoseconds / 100);
+				if (SetWaitableTimerEx(m_timer, &dueTime, 0, nullptr, nullptr, nullptr, 0)) {
+					WaitForSingleObject(m_timer, INFINITE);
+					return;
+				}
+			}
+#endif
+			std::this_thread::sleep_for(std::chrono::nanoseconds(nanoseconds));
+		}
+
+		/**
+		 * @brief Adds the time between two paced frames to the stats
+		 */
+		void RecordFrame(uint64_t frameTime) {
+			uint64_t target = Clock::ToNanoseconds(m_period);
+			uint64_t jitter = frameTime > target ? frameTime - target : target - frameTime;
+			m_jitter[m_frameCount % JitterSampleCount] = jitter;
+			m_jitterMax = (std::max)(m_jitterMax, jitter);
+			m_totalFrameTime += frameTime;
+			m_frameCount++;
+		}
+
+		double m_targetFrameRate = 0.0;
+		Clock::Ticks m_period = 0;
+		Clock::Ticks m_deadline = 0;
+		Clock::Ticks m_frameStart = 0;
+
+		uint64_t m_spinNanoseconds = 1'000'000;
+		double m_sleepOvershoot = 500'000.0;
+
+		std::array<uint64_t, JitterSampleCount> m_jitter{};
+		uint64_t m_jitterMax = 0;
+		uint64_t m_totalFrameTime = 0;
+		uint64_t m_frameCount = 0;
+
+#ifdef INEPT_PLATFORM_WINDOWS
+		HANDLE m_timer = nullptr;
+#endif
+	};
+} // namespace IneptEngine::Core
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @brief How long frames took to simulate and record, all times in nanoseconds
+	 *
+	 * The percentiles are over the last frames, the other values over every frame.
+	 */
+	struct FrameTimeStats {
+		uint64_t frameCount;
+		uint64_t totalTime;
+		uint64_t meanFrameTime;
+		uint64_t p50;
+		uint64_t p99;
+		uint64_t minFrameTime;
+		uint64_t maxFrameTime;
+	};
+
+	/**
+	 * @class FrameTimeRecorder
+	 * @brief Collects the time of every frame for a summary at the end of a run
+	 */
+	class FrameTimeRecorder {
+	public:
+		/**
+		 * @brief Number of recent frames the percentiles are computed over
+		 */
+		static constexpr size_t SampleCount = 64 * 1024;
+
+		/**
+		 * @brief Adds the time of a frame
+		 * @param frameTime The frame time in nanoseconds
+		 */
+		void Record(uint64_t frameTime) {
+			if (m_samples.size() < SampleCount) {
+				m_samples.push_back(frameTime);
+			}
+			else {
+				m_samples[m_frameCount % SampleCount] = frameTime;
+			}
+			m_minFrameTime = m_frameCount != 0 ? (std::min)(m_minFrameTime, frameTime) : frameTime;
+			m_maxFrameTime = (std::max)(m_maxFrameTime, frameTime);
+			m_totalTime += frameTime;
+			m_frameCount++;
+		}
+
+		/**
+		 * @brief Gets the number of frames recorded so far
+		 */
+		uint64_t GetFrameCount() const { return m_frameCount; }
+
+		/**
+		 * @brief Gets the frame times recorded so far
+		 */
+		FrameTimeStats GetStats() const {
+			FrameTimeStats stats = {};
+			stats.frameCount = m_frameCount;
+			if (m_frameCount == 0) {
+				return stats;
+			}
+			stats.totalTime = m_totalTime;
+			stats.meanFrameTime = m_totalTime / m_frameCount;
+
+			std::vector<uint64_t> samples = m_samples;
+			std::sort(samples.begin(), samples.end());
+			stats.p50 = samples[samples.size() / 2];
+			stats.p99 = samples[samples.size() * 99 / 100];
+			stats.minFrameTime = m_minFrameTime;
+			stats.maxFrameTime = m_maxFrameTime;
+			return stats;
+		}
+
+	private:
+		std::vector<uint64_t> m_samples;
+		uint64_t m_frameCount = 0;
+		uint64_t m_totalTime = 0;
+		uint64_t m_minFrameTime = 0;
+		uint64_t m_maxFrameTime = 0;
+	};
+} // namespace IneptEngine::Core
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class InplaceFunction
+	 * @brief Move-only function wrapper that stores its callable inside the object and never allocates
+	 *
+	 * Unlike std::function the callable is always kept in a fixed size buffer, callables that do not fit are
+	 * rejected at compile time. Calling it is a single indirect call to a function generated for the callable type.
+	 *
+	 * @tparam Signature The function signature, e.g void(int)
+	 * @tparam Capacity The size in bytes of the buffer the callable is stored in
+	 */
+	template<typename Signature, size_t Capacity = 48>
+	class InplaceFunction;
+
+	template<typename Result, typename... Args, size_t Capacity>
+	class InplaceFunction<Result(Args...), Capacity> {
+	public:
+		/**
+		 * @brief Constructs an empty function
+		 */
+		InplaceFunction() = default;
+
+		/**
+		 * @brief Constructs a function from a callable
+		 * @param callable The callable to store, it must fit in the buffer
+		 */
+		template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InplaceFunction> &&
+			std::is_invocable_r_v<Result, std::decay_t<Callable>&, Args...>>>
+		InplaceFunction(Callable&& callable) {
+			using Stored = std::decay_t<Callable>;
+			static_assert(sizeof(Stored) <= Capacity, "Callable is too large for the InplaceFunction buffer");
+			static_assert(alignof(Stored) <= alignof(std::max_align_t), "Callable alignment is too large for InplaceFunction");
+			static_assert(std::is_nothrow_move_constructible_v<Stored>, "Callable must be nothrow move constructible");
+
+			new (m_storage) Stored(std::forward<Callable>(callable));
+			m_invoke = [](void* storage, Args... args) -> Result {
+				return (*static_cast<Stored*>(storage))(std::forward<Args>(args)...);
+			};
+			m_manage = [](void* destination, void* source) {
+				if (source != nullptr) {
+					new (destination) Stored(std::move(*static_cast<Stored*>(source)));
+				}
+				else {
+					static_cast<Stored*>(destination)->~Stored();
+				}
+			};
+		}
+
+		InplaceFunction(const InplaceFunction&) = delete;
+		InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+		/**
+		 * @brief Moves the callable of another function into this one
+		 */
+		InplaceFunction(InplaceFunction&& other) noexcept {
+			MoveFrom(other);
+		}
+
+		/**
+		 * @brief Destroys the current callable and moves the callable of another function into this one
+		 */
+		InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+			if (this != &other) {
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destroys the stored callable
+		 */
+		~InplaceFunction() {
+			Reset();
+		}
+
+		/**
+		 * @brief Calls the stored callable
+		 */
+		Result operator()(Args... args) const {
+			return m_invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+		}
+
+		/**
+		 * @brief Checks if a callable is stored
+		 */
+		explicit operator bool() const { return m_invoke != nullptr; }
+
+	private:
+		void Reset() {
+			if (m_manage != nullptr) {
+				m_manage(m_storage, nullptr);
+			}
+			m_invoke = nullptr;
+			m_manage = nullptr;
+		}
+
+		void MoveFrom(InplaceFunction& other) {
+			if (other.m_manage != nullptr) {
+				other.m_manage(m_storage, other.m_storage);
+				m_invoke = other.m_invoke;
+				m_manage = other.m_manage;
+				other.Reset();
+			}
+		}
+
+		alignas(std::max_align_t) std::byte m_storage[Capacity];
+		Result(*m_invoke)(void*, Args...) = nullptr;
+
+		// Move constructs the callable from source into destination, or destroys destination if source is null
+		void(*m_manage)(void* destination, void* source) = nullptr;
+	};
+} // namespace IneptEngine::Core
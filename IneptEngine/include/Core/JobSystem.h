@@ -0,0 +1,263 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/InplaceFunction.h>
+#include <Core/WorkStealingDeque.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class JobCounter
+	 * @brief Counts the unfinished jobs of a group, jobs that depend on the group wait for it to reach zero
+	 *
+	 * Every job submitted with a counter increments it and decrements it once the job has finished and its callable
+	 * was destroyed, so whatever the job captured can be freed as soon as JobSystem::Wait returns.
+	 */
+	class JobCounter {
+	public:
+		JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		/**
+		 * @brief Checks if every job submitted with the counter has finished
+		 */
+		bool IsDone() const { return m_count.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32_t> m_count = 0;
+	};
+
+	/**
+	 * @class JobSystem
+	 * @brief Runs jobs on one thread per hardware thread, balanced by work stealing
+	 *
+	 * Every worker owns a WorkStealingDeque: it runs the jobs it submitted itself newest first and steals the oldest
+	 * jobs of the others when it runs dry, so there is no shared queue to contend on. Worker zero is the main thread,
+	 * set by the Application with SetMainThread, it runs jobs whenever it waits, the other workers sleep once they have
+	 * found no job for a while. Threads that are not workers may submit too, their jobs go through a shared queue.
+	 *
+	 * The job system is the only pool of worker threads in the engine, the EventBus runs its concurrent subscribers
+	 * on it too, so the engine never runs more threads than there are hardware threads.
+	 *
+	 * With a thread count of one no worker threads are started and every job runs on the submitting thread as it is
+	 * submitted, so runs are deterministic and can be stepped through in a debugger.
+	 *
+	 * Layers spread their OnUpdate work over all cores with ParallelFor and ParallelReduce, or submit jobs with a
+	 * counter and wait on it before the end of the update.
+	 */
+	class JobSystem {
+	public:
+		/**
+		 * @brief A job, stored without allocating
+		 */
+		using Job = InplaceFunction<void()>;
+
+		/**
+		 * @brief Number of jobs a worker holds before it runs further jobs it submits right away
+		 */
+		static constexpr size_t DequeCapacity = 4096;
+
+		/**
+		 * @brief Gets the job system, starting one worker per hardware thread on first use
+		 *
+		 * No thread is worker zero until SetMainThread or SetThreadCount is called.
+		 */
+		static JobSystem& GetInstance();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/**
+		 * @brief Restarts the workers, the calling thread becomes worker zero
+		 *
+		 * Must not be called while jobs are pending.
+		 *
+		 * @param threadCount The number of threads running jobs including the calling thread, zero for one per
+		 * hardware thread, one for the deterministic single thread mode
+		 */
+		void SetThreadCount(size_t threadCount);
+
+		/**
+		 * @brief Makes the calling thread worker zero without restarting the workers, called by the Application on the main thread
+		 *
+		 * Only one thread may be worker zero, calling it from another thread than the current worker zero restarts the
+		 * workers as SetThreadCount does, so it must not be done while jobs are pending.
+		 */
+		void SetMainThread();
+
+		/**
+		 * @brief Gets the number of threads running jobs, including worker zero
+		 */
+		size_t GetThreadCount() const { return m_workers.size(); }
+
+		/**
+		 * @brief Checks if jobs run on the submitting thread as they are submitted
+		 */
+		bool IsSingleThreaded() const { return m_workers.size() == 1; }
+
+		/**
+		 * @brief Submits a job, safe to call from any thread and from within jobs
+		 * @param job The job to run
+		 * @param counter The counter of the group the job belongs to, or a null pointer
+		 */
+		void Submit(Job job, JobCounter* counter = nullptr);
+
+		/**
+		 * @brief Runs other jobs until every job of a group has finished
+		 * @param counter The counter of the group
+		 */
+		void Wait(JobCounter& counter);
+
+		/**
+		 * @brief Calls a function for every index in [0, count) and waits for all calls to finish
+		 *
+		 * The range is split into a few chunks per thread so threads that finish early steal the remaining chunks,
+		 * the calling thread runs the first chunk itself. Calls for different indices may run at the same time.
+		 *
+		 * @param count The number of indices
+		 * @param body The function, called as body(index)
+		 * @param minChunkSize The fewest indices run by one job, raise it when a single call is cheap
+		 */
+		template<typename Body>
+		void ParallelFor(size_t count, Body&& body, size_t minChunkSize = 1) {
+			size_t chunkSize = GetChunkSize(count, minChunkSize);
+			if (chunkSize >= count) {
+				for (size_t index = 0; index < count; index++) {
+					body(index);
+				}
+				return;
+			}
+
+			JobCounter counter;
+			for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+				size_t end = (std::min)(begin + chunkSize, count);
+				Submit([&body, begin, end]() {
+					for (size_t index = begin; index < end; index++) {
+						body(index);
+					}
+					}, &counter);
+			}
+			for (size_t index = 0; index < chunkSize; index++) {
+				body(index);
+			}
+			Wait(counter);
+		}
+
+		/**
+		 * @brief Maps every index in [0, count) to a value and combines the values
+		 *
+		 * Every chunk is folded from the identity in index order and the chunk results are combined in chunk order,
+		 * so for a given thread count the result does not depend on which threads ran which chunks, even for floating
+		 * point values.
+		 *
+		 * @param count The number of indices
+		 * @param identity The value combining with any value leaves unchanged, e.g zero for a sum
+		 * @param map The function turning an index into a value, called as map(index)
+		 * @param combine The function combining two values, called as combine(left, right)
+		 * @param minChunkSize The fewest indices mapped by one job
+		 * @return The combined value, the identity if count is zero
+		 */
+		template<typename T, typename Map, typename Combine>
+		T ParallelReduce(size_t count, T identity, Map&& map, Combine&& combine, size_t minChunkSize = 1) {
+			size_t chunkSize = GetChunkSize(count, minChunkSize);
+			size_t chunkCount = chunkSize != 0 ? (count + chunkSize - 1) / chunkSize : 0;
+
+			std::vector<T> partials(chunkCount, identity);
+			ParallelFor(chunkCount, [&](size_t chunk) {
+				size_t end = (std::min)((chunk + 1) * chunkSize, count);
+				T value = identity;
+				for (size_t index = chunk * chunkSize; index < end; index++) {
+					value = combine(std::move(value), map(index));
+				}
+				partials[chunk] = std::move(value);
+				});
+
+			T result = std::move(identity);
+			for (T& partial : partials) {
+				result = combine(std::move(result), std::move(partial));
+			}
+			return result;
+		}
+
+		/**
+		 * @brief Gets the number of indices ParallelFor runs per job
+		 * @param count The number of indices
+		 * @param minChunkSize The fewest indices per job
+		 * @return The chunk size, count itself if the range is not split
+		 */
+		size_t GetChunkSize(size_t count, size_t minChunkSize = 1) const {
+			if (IsSingleThreaded()) {
+				return count;
+			}
+			size_t chunkCount = m_workers.size() * ChunksPerThread;
+			return (std::max)((count + chunkCount - 1) / chunkCount, (std::max)(minChunkSize, size_t(1)));
+		}
+
+	private:
+		// Enough chunks that threads finishing early can steal some, few enough that jobs stay cheap next to the work
+		static constexpr size_t ChunksPerThread = 4;
+
+		// Failed searches for a job before a worker goes to sleep
+		static constexpr uint32_t IdleSpinCount = 256;
+
+		struct JobEntry {
+			Job job;
+			JobCounter* counter;
+		};
+
+		struct EntryCache;
+
+		struct Worker {
+			WorkStealingDeque<JobEntry*, DequeCapacity> jobs;
+			size_t index = 0;
+			std::thread thread;
+		};
+
+		JobSystem();
+		~JobSystem();
+
+		/**
+		 * @brief Starts the workers, the calling thread becomes worker zero if bindCaller is set
+		 */
+		void StartWorkers(size_t threadCount, bool bindCaller);
+		void StopWorkers();
+		void WorkerLoop(size_t index);
+
+		/**
+		 * @brief Gets the worker of the calling thread, or a null pointer if it is not a worker of this system
+		 */
+		Worker* GetThreadWorker() const;
+
+		/**
+		 * @brief Takes a job from the worker's own deque, the shared queue or another worker, in that order
+		 */
+		JobEntry* FindJob(Worker* worker);
+
+		void Run(JobEntry* entry);
+		void WakeWorker();
+
+		static EntryCache& GetEntryCache();
+		static JobEntry* AllocateEntry();
+		static void FreeEntry(JobEntry* entry);
+
+		std::vector<std::unique_ptr<Worker>> m_workers;
+		uint64_t m_generation = 0;
+
+		// The thread running as worker zero, none until one is set
+		std::thread::id m_mainThread;
+		std::atomic<bool> m_stopping = false;
+
+		// Jobs submitted by threads that are not workers
+		std::mutex m_sharedJobsMutex;
+		std::deque<JobEntry*> m_sharedJobs;
+		std::atomic<size_t> m_sharedJobCount = 0;
+
+		// Bumped on every submit, sleeping workers wait for it to change
+		alignas(64) std::atomic<uint32_t> m_wakeSignal = 0;
+		std::atomic<uint32_t> m_sleepingWorkers = 0;
+	};
+} // namespace IneptEngine::Core
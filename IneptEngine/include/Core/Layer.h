@@ -1,16 +1,69 @@
 #pragma once
 
 #include <IneptEngine.h>
+#include <Rendering/RenderFrame.h>
 
 namespace IneptEngine::Core {
     class Layer {
     public:
+        /**
+         * @brief Flags for the hooks a layer implements, the LayerStack only calls the hooks of the given phases
+         */
+        enum Phase : uint32_t {
+            UpdatePhase = 1 << 0,
+            RenderPhase = 1 << 1,
+            EventPhase = 1 << 2,
+            AllPhases = UpdatePhase | RenderPhase | EventPhase,
+        };
+
+        /**
+         * @brief Constructs a layer, the phases and categories are read once when it is pushed onto the LayerStack
+         * @param phases The Phase flags of the hooks the layer implements
+         * @param eventCategories The EventCategory flags of the events OnEvent receives
+         */
+        Layer(uint32_t phases = AllPhases, int eventCategories = ALL_CATEGORIES)
+            : m_phases(phases), m_eventCategories(eventCategories) {}
+
         virtual ~Layer() = default;
 
         virtual void OnAttach() {}
         virtual void OnDetach() {}
+
+        /**
+         * @brief Updates the layer, independent work can be spread over all cores with Core::JobSystem::ParallelFor
+         * @param deltaTime The time the update advances the layer by, in seconds
+         */
         virtual void OnUpdate(float deltaTime) {}
-        virtual void OnRender() {}
-        virtual void OnEvent(Events::Event* event) {}
+
+        /**
+         * @brief Renders the layer by recording into the frame, which may be drawn on the render thread after the next update
+         * @param alpha How far the time is between the last two simulation steps, in [0, 1), always 1 with a variable timestep
+         * @param frame The frame being recorded, see RenderFrame::Submit
+         */
+        virtual void OnRender(float alpha, Rendering::RenderFrame& frame) {}
+
+        /**
+         * @brief Handles an event of one of the layer's categories, from the top of the LayerStack down
+         * @param event The event
+         * @return True if the layer handled the event, which keeps it from the layers below
+         *
+         * Other subscribers may read the event on other threads at the same time, so whether it was handled is returned
+         * instead of stored in the event.
+         */
+        virtual bool OnEvent(Events::Event* event) { return false; }
+
+        /**
+         * @brief Gets the Phase flags of the hooks the layer implements
+         */
+        uint32_t GetPhases() const { return m_phases; }
+
+        /**
+         * @brief Gets the EventCategory flags of the events the layer receives
+         */
+        int GetEventCategories() const { return m_eventCategories; }
+
+    private:
+        uint32_t m_phases;
+        int m_eventCategories;
     };
-}
\ No newline at end of file
+}
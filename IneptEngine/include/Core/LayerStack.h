@@ -3,6 +3,14 @@
 #include <Core/Layer.h>
 
 namespace IneptEngine::Core {
+    /**
+     * @class LayerStack
+     * @brief Owns the layers of an application and calls their hooks, layers first and overlays on top
+     *
+     * Every phase has its own list of the layers implementing it, rebuilt when a layer is pushed or popped, so a
+     * frame only makes virtual calls into layers that do something in that phase. Events go from the top layer
+     * down, skipping layers that are not interested in the event's category, until a layer marks it handled.
+     */
     class LayerStack {
     public:
         LayerStack() = default;
@@ -14,15 +22,28 @@ namespace IneptEngine::Core {
         void PopOverlay(Layer* overlay);
 
         void OnUpdate(float deltaTime);
-        void OnRender();
+        void OnRender(float alpha, Rendering::RenderFrame& frame);
         void OnEvent(Events::Event* event);
 
         std::vector<Layer*>::iterator begin() { return m_layers.begin(); }
         std::vector<Layer*>::iterator end() { return m_layers.end(); }
 
     private:
+        struct EventTarget {
+            Layer* layer;
+            int categories;
+        };
+
+        void RebuildDispatchLists();
+
         std::vector<Layer*> m_layers;
         unsigned int m_layerInsertIndex = 0;
+
+        std::vector<Layer*> m_updateLayers;
+        std::vector<Layer*> m_renderLayers;
+
+        // Ordered from the top of the stack down
+        std::vector<EventTarget> m_eventTargets;
     };
 
     LayerStack::~LayerStack() {
@@ -32,8 +53,10 @@ namespace IneptEngine::Core {
     }
 
     void LayerStack::PushLayer(Layer* layer) {
+        MEMORY_TAG_SCOPE(Layers);
         m_layers.emplace(m_layers.begin() + m_layerInsertIndex, layer);
         m_layerInsertIndex++;
+        RebuildDispatchLists();
         layer->OnAttach();
     }
 
@@ -43,12 +66,14 @@ namespace IneptEngine::Core {
             layer->OnDetach();
             m_layers.erase(it);
             m_layerInsertIndex--;
+            RebuildDispatchLists();
         }
-        layer->OnDetach();
     }
 
     void LayerStack::PushOverlay(Layer* overlay) {
+        MEMORY_TAG_SCOPE(Layers);
         m_layers.emplace_back(overlay);
+        RebuildDispatchLists();
         overlay->OnAttach();
     }
 
@@ -57,27 +82,56 @@ namespace IneptEngine::Core {
         if (it != m_layers.end()) {
             overlay->OnDetach();
             m_layers.erase(it);
+            RebuildDispatchLists();
         }
     }
 
-    void LayerStack::OnUpdate(float deltaTime) {
+    void LayerStack::RebuildDispatchLists() {
+        m_updateLayers.clear();
+        m_renderLayers.clear();
+        m_eventTargets.clear();
         for (Layer* layer : m_layers) {
+            if (layer->GetPhases() & Layer::UpdatePhase) {
+                m_updateLayers.push_back(layer);
+            }
+            if (layer->GetPhases() & Layer::RenderPhase) {
+                m_renderLayers.push_back(layer);
+            }
+        }
+        for (auto it = m_layers.rbegin(); it != m_layers.rend(); ++it) {
+            if (((*it)->GetPhases() & Layer::EventPhase) && (*it)->GetEventCategories() != Events::EventCategory::None) {
+                m_eventTargets.push_back({ *it, (*it)->GetEventCategories() });
+            }
+        }
+    }
+
+    void LayerStack::OnUpdate(float deltaTime) {
+        PROFILE_SCOPE("LayerStack::OnUpdate");
+        MEMORY_TAG_SCOPE(Layers);
+        for (Layer* layer : m_updateLayers) {
             layer->OnUpdate(deltaTime);
         }
     }
 
     void LayerStack::OnEvent(Events::Event* event) {
-        for (auto it = m_layers.rbegin(); it != m_layers.rend(); ++it) {
-           // if (event->Handled) {
-          //      break;
-           // }
-            (*it)->OnEvent(event);
+        MEMORY_TAG_SCOPE(Layers);
+        int category = event->GetCategory();
+        for (const EventTarget& target : m_eventTargets) {
+            if ((target.categories & category) == 0) {
+                continue;
+            }
+            bool handled = target.layer->OnEvent(event);
+            if (handled) {
+                break;
+            }
         }
     }
 
-    void LayerStack::OnRender() {
-        for (Layer* layer : m_layers) {
-            layer->OnRender();
+    void LayerStack::OnRender(float alpha, Rendering::RenderFrame& frame) {
+        PROFILE_SCOPE("LayerStack::OnRender");
+        MEMORY_TAG_SCOPE(Layers);
+        for (Layer* layer : m_renderLayers) {
+            layer->OnRender(alpha, frame);
         }
     }
 }
\ No newline at end of file
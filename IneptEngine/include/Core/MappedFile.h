@@ -0,0 +1,105 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class MappedFile
+	 * @brief File accessed through a memory mapping, either read as a whole or appended to
+	 *
+	 * When writing, the file is grown and remapped in large steps so that appending is usually a plain memory copy.
+	 * On close the file is truncated to the number of bytes actually written.
+	 */
+	class MappedFile {
+	public:
+		/**
+		 * @brief Number of bytes the file grows by at least when an append does not fit
+		 */
+		static constexpr size_t GrowSize = 4 << 20;
+
+		MappedFile() = default;
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		 * @brief Closes the file
+		 */
+		~MappedFile() {
+			Close();
+		}
+
+		/**
+		 * @brief Creates or truncates a file and maps it for appending
+		 * @param path The path of the file
+		 * @return True if the file was opened
+		 */
+		bool OpenForWriting(const std::string& path);
+
+		/**
+		 * @brief Maps an existing file for reading
+		 * @param path The path of the file
+		 * @return True if the file was opened
+		 */
+		bool OpenForReading(const std::string& path);
+
+		/**
+		 * @brief Appends bytes to the end of a file opened for writing
+		 * @param data The bytes to append
+		 * @param size The number of bytes to append
+		 * @return False if the file could not be grown
+		 */
+		bool Append(const void* data, size_t size);
+
+		/**
+		 * @brief Unmaps and closes the file, a written file is truncated to its size
+		 */
+		void Close();
+
+		/**
+		 * @brief Checks if a file is open
+		 */
+		bool IsOpen() const {
+#ifdef INEPT_PLATFORM_WINDOWS
+			return m_file != INVALID_HANDLE_VALUE;
+#else
+			return m_file >= 0;
+#endif
+		}
+
+		/**
+		 * @brief The mapped bytes of the file, only the first GetSize() bytes are valid
+		 */
+		const std::byte* GetData() const { return m_data; }
+
+		/**
+		 * @brief The number of bytes in the file
+		 */
+		size_t GetSize() const { return m_size; }
+
+	private:
+		/**
+		 * @brief Maps the file with the given size, growing the file if it is written
+		 * @param capacity The number of bytes to map
+		 * @return True if the file was mapped
+		 */
+		bool Map(size_t capacity);
+
+		/**
+		 * @brief Removes the current mapping
+		 */
+		void Unmap();
+
+		std::byte* m_data = nullptr;
+		size_t m_size = 0;
+		size_t m_capacity = 0;
+		bool m_writable = false;
+
+#ifdef INEPT_PLATFORM_WINDOWS
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		HANDLE m_mapping = nullptr;
+#else
+		int m_file = -1;
+#endif
+	};
+} // namespace IneptEngine::Core
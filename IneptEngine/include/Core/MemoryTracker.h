@@ -0,0 +1,243 @@
+#pragma once
+
+#include <iepch.h>
+
+/**
+ * @brief Tags the heap allocations of the calling thread until the end of the enclosing scope, e.g MEMORY_TAG_SCOPE(Rendering)
+ *
+ * INEPT_NEW(tag) allocates with a tag and records the call site when call-site capture is on, e.g
+ * INEPT_NEW(Rendering) Square(position, size). Memory from it is freed with a plain delete.
+ * Tracking is only compiled in with INEPT_ENABLE_MEMORY_TRACKING, without it the tag scopes expand to nothing and
+ * INEPT_NEW to new.
+ */
+#ifdef INEPT_ENABLE_MEMORY_TRACKING
+#define MEMORY_CONCAT_INNER(a, b) a##b
+#define MEMORY_CONCAT(a, b) MEMORY_CONCAT_INNER(a, b)
+#define MEMORY_TAG_SCOPE(tag) ::IneptEngine::Core::MemoryTagScope MEMORY_CONCAT(memoryTagScope, __LINE__)(::IneptEngine::Core::MemoryTag::tag)
+#define INEPT_NEW(tag) new ([]() -> const ::IneptEngine::Core::MemoryCallSite& { \
+        static const ::IneptEngine::Core::MemoryCallSite& site = ::IneptEngine::Core::MemoryTracker::RegisterCallSite(::IneptEngine::Core::MemoryTag::tag, __FILE__, __LINE__); \
+        return site; }())
+#else
+#define MEMORY_TAG_SCOPE(tag)
+#define INEPT_NEW(tag) new
+#endif
+
+namespace IneptEngine::Core {
+	/**
+	 * @brief The subsystem memory is allocated for
+	 */
+	enum class MemoryTag : uint8_t {
+		Untagged,
+		Core,
+		Events,
+		Rendering,
+		Input,
+		Windowing,
+		Scripting,
+		Layers,
+		Profiler,
+		Count
+	};
+
+	/**
+	 * @brief A place in the code that allocates with INEPT_NEW, registered once per call site
+	 */
+	struct MemoryCallSite {
+		const char* file = nullptr;
+		int line = 0;
+		MemoryTag tag = MemoryTag::Untagged;
+		uint16_t index = 0;
+	};
+
+	/**
+	 * @brief The heap memory of a tag, summed over every thread
+	 *
+	 * Values are signed so the difference of two snapshots can be stored in the same type.
+	 */
+	struct MemoryTagStats {
+		int64_t liveBytes;
+		int64_t liveAllocations;
+		int64_t allocatedBytes;
+		int64_t allocations;
+	};
+
+	/**
+	 * @brief The memory allocated from a call site that is still alive
+	 */
+	struct MemoryCallSiteStats {
+		const char* file;
+		int line;
+		MemoryTag tag;
+		uint16_t index;
+		int64_t liveBytes;
+		int64_t liveAllocations;
+	};
+
+	/**
+	 * @brief The heap memory in use at one moment, per tag and per captured call site
+	 */
+	struct MemorySnapshot {
+		std::array<MemoryTagStats, static_cast<size_t>(MemoryTag::Count)> tags = {};
+
+		/**
+		 * @brief Call sites with live allocations, only filled while call-site capture is on
+		 */
+		std::vector<MemoryCallSiteStats> callSites;
+
+		/**
+		 * @brief Gets the live bytes of all tags
+		 */
+		int64_t GetLiveBytes() const {
+			int64_t bytes = 0;
+			for (const MemoryTagStats& tag : tags) {
+				bytes += tag.liveBytes;
+			}
+			return bytes;
+		}
+
+		/**
+		 * @brief Computes how memory changed since an earlier snapshot, e.g the previous frame
+		 * @param before The earlier snapshot
+		 * @return The growth per tag, and the call sites that changed ordered from the largest growth down
+		 */
+		MemorySnapshot Diff(const MemorySnapshot& before) const;
+	};
+
+	/**
+	 * @class MemoryTracker
+	 * @brief Counts the heap memory of every subsystem by replacing the global operator new and delete
+	 *
+	 * Every allocation carries a small header with its size, tag and call site, so freeing it credits the tag it was
+	 * allocated for, whichever thread frees it. The counters are per thread and only written by their own thread,
+	 * tracking an allocation costs a few plain loads and stores, and a snapshot sums them over the threads. Allocations
+	 * take the tag of the innermost MEMORY_TAG_SCOPE on their thread, or the tag and call site given to INEPT_NEW.
+	 *
+	 * Budgets are checked once per frame, a tag going over its budget logs a warning.
+	 */
+	class MemoryTracker {
+	public:
+		/**
+		 * @brief Number of INEPT_NEW call sites that can be registered, later ones are counted under their tag only
+		 */
+		static constexpr size_t MaxCallSites = 4096;
+
+		/**
+		 * @brief Checks if the global operator new is tracked, see INEPT_ENABLE_MEMORY_TRACKING
+		 */
+		static constexpr bool IsEnabled() {
+#ifdef INEPT_ENABLE_MEMORY_TRACKING
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * @brief Gets the name of a tag, e.g Rendering
+		 */
+		static const char* GetTagName(MemoryTag tag);
+
+		/**
+		 * @brief Gets the tag the allocations of the calling thread are counted under
+		 */
+		static MemoryTag GetCurrentTag() { return t_currentTag; }
+
+		/**
+		 * @brief Allocates tracked memory, for allocators of their own that should show up under a tag
+		 * @param size The number of bytes
+		 * @param alignment The alignment, a power of two
+		 * @param tag The tag the memory is counted under
+		 * @param callSite The index of the call site, zero for none
+		 * @return The memory, or a null pointer if the heap is exhausted
+		 */
+		static void* Allocate(size_t size, size_t alignment, MemoryTag tag, uint16_t callSite = 0);
+
+		/**
+		 * @brief Frees memory from Allocate
+		 * @param memory The memory, may be a null pointer
+		 */
+		static void Free(void* memory);
+
+		/**
+		 * @brief Registers a call site of INEPT_NEW, the same file and line always give the same call site
+		 */
+		static const MemoryCallSite& RegisterCallSite(MemoryTag tag, const char* file, int line);
+
+		/**
+		 * @brief Starts or stops counting the memory of INEPT_NEW per call site, allocations made meanwhile keep being counted
+		 * @param enabled True to count per call site
+		 */
+		static void SetCallSiteCapture(bool enabled);
+
+		/**
+		 * @brief Checks if the memory of INEPT_NEW is counted per call site
+		 */
+		static bool IsCapturingCallSites();
+
+		/**
+		 * @brief Sets the live bytes a tag should stay below
+		 * @param tag The tag
+		 * @param bytes The budget, zero for none
+		 */
+		static void SetBudget(MemoryTag tag, uint64_t bytes);
+
+		/**
+		 * @brief Gets the budget of a tag, zero if it has none
+		 */
+		static uint64_t GetBudget(MemoryTag tag);
+
+		/**
+		 * @brief Checks the budgets, called by the Application at the start of each frame
+		 */
+		static void BeginFrame();
+
+		/**
+		 * @brief Gets the memory in use right now
+		 */
+		static MemorySnapshot TakeSnapshot();
+
+		/**
+		 * @brief Logs the tags and call sites of a snapshot or of the difference of two
+		 * @param snapshot The snapshot
+		 * @param title What the snapshot shows, e.g at exit
+		 */
+		static void Log(const MemorySnapshot& snapshot, std::string_view title);
+
+	private:
+		friend class MemoryTagScope;
+
+		static inline thread_local MemoryTag t_currentTag = MemoryTag::Untagged;
+	};
+
+	/**
+	 * @class MemoryTagScope
+	 * @brief Tags the allocations of the calling thread from its construction to its destruction, see MEMORY_TAG_SCOPE
+	 */
+	class MemoryTagScope {
+	public:
+		explicit MemoryTagScope(MemoryTag tag) : m_previousTag(MemoryTracker::t_currentTag) {
+			MemoryTracker::t_currentTag = tag;
+		}
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+		~MemoryTagScope() {
+			MemoryTracker::t_currentTag = m_previousTag;
+		}
+
+	private:
+		MemoryTag m_previousTag;
+	};
+} // namespace IneptEngine::Core
+
+#ifdef INEPT_ENABLE_MEMORY_TRACKING
+void* operator new(size_t size, const IneptEngine::Core::MemoryCallSite& site);
+void* operator new[](size_t size, const IneptEngine::Core::MemoryCallSite& site);
+void* operator new(size_t size, std::align_val_t alignment, const IneptEngine::Core::MemoryCallSite& site);
+void* operator new[](size_t size, std::align_val_t alignment, const IneptEngine::Core::MemoryCallSite& site);
+void operator delete(void* memory, const IneptEngine::Core::MemoryCallSite& site) noexcept;
+void operator delete[](void* memory, const IneptEngine::Core::MemoryCallSite& site) noexcept;
+void operator delete(void* memory, std::align_val_t alignment, const IneptEngine::Core::MemoryCallSite& site) noexcept;
+void operator delete[](void* memory, std::align_val_t alignment, const IneptEngine::Core::MemoryCallSite& site) noexcept;
+#endif
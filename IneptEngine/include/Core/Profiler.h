@@ -0,0 +1,106 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/Clock.h>
+
+/**
+ * @brief Records the time spent until the end of the enclosing scope as a zone of the given name, which must be a string literal
+ *
+ * Zones are only compiled in with INEPT_ENABLE_PROFILER, without it the macros expand to nothing.
+ */
+#ifdef INEPT_ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ::IneptEngine::Core::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#endif
+
+namespace IneptEngine::Core {
+	/**
+	 * @class Profiler
+	 * @brief Captures the zones of a number of frames on every thread and writes them as a Chrome trace
+	 *
+	 * Every thread records into its own fixed size buffer that only it writes to, so recording a zone is two clock
+	 * reads and one store without locks, and costs a single load while nothing is captured. A capture starts at the
+	 * next frame and is written when its last frame ends, in the Chrome trace event format that chrome://tracing and
+	 * ui.perfetto.dev open.
+	 */
+	class Profiler {
+	public:
+		/**
+		 * @brief Number of zones a thread records per capture, zones beyond it are dropped
+		 */
+		static constexpr size_t ZonesPerThread = 64 * 1024;
+
+		/**
+		 * @brief Captures the next frames and writes them to a file once they are done
+		 * @param frameCount The number of frames to capture
+		 * @param path The file the trace is written to
+		 */
+		static void CaptureFrames(uint32_t frameCount, const std::string& path);
+
+		/**
+		 * @brief Starts a new frame, called by the Application at the start of each frame
+		 *
+		 * Starts a requested capture, or ends the current one and writes it once enough frames were captured.
+		 */
+		static void BeginFrame();
+
+		/**
+		 * @brief Checks if zones are being recorded
+		 */
+		static bool IsCapturing() { return s_capturing.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief Gets the id of the current or last capture, zero before the first one, it changes each time a capture starts
+		 */
+		static uint64_t GetCapture() { return s_capture.load(std::memory_order_acquire); }
+
+		/**
+		 * @brief Names the calling thread in captures
+		 * @param name The name, e.g Render thread
+		 */
+		static void SetThreadName(const std::string& name);
+
+		/**
+		 * @brief Records a zone of the calling thread
+		 * @param name The name of the zone, it must outlive the capture
+		 * @param start When the zone started
+		 * @param end When the zone ended
+		 * @param capture The capture the zone started in, the zone is dropped if that capture is over
+		 */
+		static void RecordZone(const char* name, Clock::Ticks start, Clock::Ticks end, uint64_t capture);
+
+	private:
+		static inline std::atomic<bool> s_capturing = false;
+		static inline std::atomic<uint64_t> s_capture = 0;
+	};
+
+	/**
+	 * @class ProfileScope
+	 * @brief Records a zone from its construction to its destruction, see PROFILE_SCOPE
+	 */
+	class ProfileScope {
+	public:
+		explicit ProfileScope(const char* name)
+			: m_name(name), m_capture(Profiler::IsCapturing() ? Profiler::GetCapture() : 0), m_start(m_capture != 0 ? Clock::Now() : 0) {}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+		~ProfileScope() {
+			if (m_start != 0) {
+				Profiler::RecordZone(m_name, m_start, Clock::Now(), m_capture);
+			}
+		}
+
+	private:
+		const char* m_name;
+		uint64_t m_capture;
+		Clock::Ticks m_start;
+	};
+} // namespace IneptEngine::Core
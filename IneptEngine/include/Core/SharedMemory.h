@@ -0,0 +1,78 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class SharedMemory
+	 * @brief Named block of memory mapped into several processes
+	 *
+	 * One process creates the block, any number of processes open it by name afterwards. The block is zero filled when
+	 * created and stays alive while it is mapped anywhere, the name is removed once the creating process closes it.
+	 */
+	class SharedMemory {
+	public:
+		SharedMemory() = default;
+
+		SharedMemory(const SharedMemory&) = delete;
+		SharedMemory& operator=(const SharedMemory&) = delete;
+
+		/**
+		 * @brief Unmaps the block
+		 */
+		~SharedMemory() {
+			Close();
+		}
+
+		/**
+		 * @brief Creates a block and maps it, replacing a block left behind under the same name
+		 * @param name The name other processes open the block by, without slashes
+		 * @param size The size of the block in bytes
+		 * @return True if the block was created
+		 */
+		bool Create(const std::string& name, size_t size);
+
+		/**
+		 * @brief Maps a block created by another process
+		 * @param name The name the block was created with
+		 * @param size The number of bytes to map, at most the size the block was created with
+		 * @return True if the block was opened
+		 */
+		bool Open(const std::string& name, size_t size);
+
+		/**
+		 * @brief Unmaps the block, and removes its name if this process created it
+		 */
+		void Close();
+
+		/**
+		 * @brief Checks if a block is mapped
+		 */
+		bool IsOpen() const { return m_data != nullptr; }
+
+		/**
+		 * @brief The mapped bytes of the block
+		 */
+		std::byte* GetData() const { return m_data; }
+
+		/**
+		 * @brief The number of mapped bytes
+		 */
+		size_t GetSize() const { return m_size; }
+
+	private:
+		/**
+		 * @brief Gets the name of the block in the namespace of the operating system
+		 */
+		static std::string GetSystemName(const std::string& name);
+
+		std::byte* m_data = nullptr;
+		size_t m_size = 0;
+		std::string m_name;
+		bool m_owner = false;
+
+#ifdef INEPT_PLATFORM_WINDOWS
+		HANDLE m_mapping = nullptr;
+#endif
+	};
+} // namespace IneptEngine::Core
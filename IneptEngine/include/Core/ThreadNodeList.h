@@ -0,0 +1,129 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class ThreadNodeList
+	 * @brief Lock-free list of per-thread nodes, each held by at most one thread and reused once that thread has exited
+	 *
+	 * A thread acquires a node the first time it needs one and releases it when it exits, usually through a thread_local
+	 * ThreadNodeHandle. The node and its data outlive the thread and are handed to the next thread that acquires one.
+	 * Nodes are only ever added while the list lives, so any thread can walk them from GetFirst at any time.
+	 * The list is constant initialized and only allocates through the function passed to Acquire, so it can be used
+	 * before any constructor has run.
+	 *
+	 * @tparam T The data of a thread
+	 */
+	template<typename T>
+	class ThreadNodeList {
+	public:
+		struct Node {
+			T value{};
+
+			// Nodes are numbered from zero in the order they were added
+			uint32_t id = 0;
+			std::atomic<bool> inUse = false;
+			Node* next = nullptr;
+		};
+
+		constexpr ThreadNodeList() = default;
+		ThreadNodeList(const ThreadNodeList&) = delete;
+		ThreadNodeList& operator=(const ThreadNodeList&) = delete;
+
+		/**
+		 * @brief Takes a node released by an exited thread, or adds a new one to the list
+		 * @param createNode Returns a new default constructed node, only called if no node is free
+		 * @return The node, held by the calling thread until it is released
+		 */
+		template<typename CreateNode>
+		Node* Acquire(CreateNode&& createNode) {
+			for (Node* node = m_first.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+				bool inUse = false;
+				if (!node->inUse.load(std::memory_order_relaxed) && node->inUse.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+					return node;
+				}
+			}
+
+			Node* node = createNode();
+			node->id = m_count.fetch_add(1, std::memory_order_relaxed);
+			node->inUse.store(true, std::memory_order_relaxed);
+			node->next = m_first.load(std::memory_order_relaxed);
+			while (!m_first.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+			}
+			return node;
+		}
+
+		/**
+		 * @brief Takes a node released by an exited thread, or adds one allocated with new
+		 */
+		Node* Acquire() {
+			return Acquire([]() { return new Node(); });
+		}
+
+		/**
+		 * @brief Hands a node back, the next thread to acquire one may take it
+		 */
+		static void Release(Node* node) {
+			node->inUse.store(false, std::memory_order_release);
+		}
+
+		/**
+		 * @brief Gets the most recently added node, the others follow through Node::next
+		 */
+		Node* GetFirst() const {
+			return m_first.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief Deletes the nodes allocated with new, once no thread holds or walks them anymore
+		 */
+		void DeleteNodes() {
+			Node* node = m_first.exchange(nullptr, std::memory_order_acquire);
+			while (node != nullptr) {
+				Node* next = node->next;
+				delete node;
+				node = next;
+			}
+		}
+
+	private:
+		std::atomic<Node*> m_first = nullptr;
+		std::atomic<uint32_t> m_count = 0;
+	};
+
+	/**
+	 * @class ThreadNodeHandle
+	 * @brief The node of a ThreadNodeList a thread holds, declared thread_local so the node is released when the thread exits
+	 *
+	 * @tparam T The data of a thread
+	 */
+	template<typename T>
+	class ThreadNodeHandle {
+	public:
+		using Node = typename ThreadNodeList<T>::Node;
+
+		constexpr ThreadNodeHandle() = default;
+		ThreadNodeHandle(const ThreadNodeHandle&) = delete;
+		ThreadNodeHandle& operator=(const ThreadNodeHandle&) = delete;
+
+		~ThreadNodeHandle() {
+			if (m_node != nullptr) {
+				ThreadNodeList<T>::Release(m_node);
+			}
+		}
+
+		/**
+		 * @brief Gets the node of the thread, nullptr until one is set
+		 */
+		Node* Get() const { return m_node; }
+
+		/**
+		 * @brief Sets the node the thread acquired
+		 */
+		void Set(Node* node) { m_node = node; }
+
+	private:
+		Node* m_node = nullptr;
+	};
+} // namespace IneptEngine::Core
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/Clock.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @brief How the Application advances the simulation every frame
+	 */
+	enum class TimestepMode {
+		/**
+		 * @brief One update per frame with the measured frame time, simulation speed follows the frame rate
+		 */
+		Variable,
+
+		/**
+		 * @brief Zero or more updates of a fixed length per frame, rendering interpolates between the last two
+		 */
+		Fixed
+	};
+
+	/**
+	 * @class FrameClock
+	 * @brief Measures the time between frames with the engine clock
+	 */
+	class FrameClock {
+	public:
+		/**
+		 * @brief Longest frame time returned by Tick, so a breakpoint or a stalled window does not fast-forward the simulation
+		 */
+		static constexpr double MaxFrameTime = 0.25;
+
+		/**
+		 * @brief Ends the current frame and starts the next
+		 * @return The time since the previous call in seconds, zero on the first call, or the fixed frame time if one is set
+		 */
+		double Tick() {
+			Clock::Ticks now = Clock::Now();
+			double frameTime = m_lastTick != 0 ? static_cast<double>(Clock::ElapsedNanoseconds(m_lastTick, now)) / 1e9 : 0.0;
+			m_lastTick = now;
+			if (m_fixedFrameTime > 0.0) {
+				return m_fixedFrameTime;
+			}
+			return (std::min)(frameTime, MaxFrameTime);
+		}
+
+		/**
+		 * @brief Makes every frame report the same time regardless of how long it took, so runs are reproducible
+		 * @param frameTime The time of a frame in seconds, zero to measure frames again
+		 */
+		void SetFixedFrameTime(double frameTime) {
+			m_fixedFrameTime = frameTime;
+		}
+
+	private:
+		Clock::Ticks m_lastTick = 0;
+		double m_fixedFrameTime = 0.0;
+	};
+
+	/**
+	 * @class FixedTimestep
+	 * @brief Accumulates frame time and turns it into a whole number of fixed simulation steps
+	 *
+	 * Time that is not yet a whole step is carried over to the next frame, and the fraction of a step it makes up is
+	 * the interpolation alpha renderers blend the last two simulated states with. When a frame would need more than
+	 * the maximum number of catch-up steps, the surplus is dropped so a slow frame cannot cause an ever longer one.
+	 */
+	class FixedTimestep {
+	public:
+		/**
+		 * @brief Constructs a fixed timestep
+		 * @param tickRate The number of steps per second
+		 * @param maxCatchUpSteps The largest number of steps run in one frame
+		 */
+		explicit FixedTimestep(double tickRate = 60.0, uint32_t maxCatchUpSteps = 5) {
+			SetTickRate(tickRate);
+			SetMaxCatchUpSteps(maxCatchUpSteps);
+		}
+
+		/**
+		 * @brief Adds the time of a frame
+		 * @param frameTime The frame time in seconds
+		 * @return The number of steps to run this frame
+		 */
+		uint32_t Advance(double frameTime) {
+			m_accumulator += frameTime;
+			uint32_t steps = 0;
+			while (m_accumulator >= m_stepTime && steps < m_maxCatchUpSteps) {
+				m_accumulator -= m_stepTime;
+				steps++;
+			}
+
+			if (m_accumulator >= m_stepTime) {
+				uint64_t dropped = static_cast<uint64_t>(m_accumulator / m_stepTime);
+				m_droppedSteps += dropped;
+				m_accumulator -= static_cast<double>(dropped) * m_stepTime;
+			}
+			return steps;
+		}
+
+		/**
+		 * @brief Gets how far the time is between the last step and the next one
+		 * @return The interpolation alpha in [0, 1)
+		 */
+		float GetAlpha() const {
+			return static_cast<float>(m_accumulator / m_stepTime);
+		}
+
+		/**
+		 * @brief Gets the length of a step in seconds, the delta time passed to every fixed update
+		 */
+		double GetStepTime() const { return m_stepTime; }
+
+		/**
+		 * @brief Sets the number of steps per second
+		 * @param tickRate The tick rate in Hz, must be positive
+		 */
+		void SetTickRate(double tickRate) {
+			m_stepTime = 1.0 / (tickRate > 0.0 ? tickRate : 60.0);
+		}
+
+		/**
+		 * @brief Sets the largest number of steps run in one frame
+		 * @param maxCatchUpSteps The number of steps, at least one
+		 */
+		void SetMaxCatchUpSteps(uint32_t maxCatchUpSteps) {
+			m_maxCatchUpSteps = (std::max)(maxCatchUpSteps, uint32_t(1));
+		}
+
+		/**
+		 * @brief Gets the number of steps dropped because a frame needed more than the maximum number of catch-up steps
+		 */
+		uint64_t GetDroppedSteps() const { return m_droppedSteps; }
+
+	private:
+		double m_stepTime = 1.0 / 60.0;
+		double m_accumulator = 0.0;
+		uint32_t m_maxCatchUpSteps = 5;
+		uint64_t m_droppedSteps = 0;
+	};
+} // namespace IneptEngine::Core
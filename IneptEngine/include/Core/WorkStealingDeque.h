@@ -0,0 +1,103 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Core {
+	/**
+	 * @class WorkStealingDeque
+	 * @brief Bounded lock-free Chase-Lev deque, its owner pushes and pops at the bottom while other threads steal from the top
+	 *
+	 * The owner works through its own items newest first, which keeps the data they touch in its caches, while thieves
+	 * take the oldest items, which are usually the largest pieces of work left. Only the owner and a thief racing for
+	 * the very last item ever compare-and-swap, every other push and pop is a plain load and store.
+	 *
+	 * @tparam T The stored pointer type
+	 * @tparam Capacity The number of items the deque holds, must be a power of two
+	 */
+	template<typename T, size_t Capacity>
+	class WorkStealingDeque {
+		static_assert(std::is_pointer_v<T>, "WorkStealingDeque stores pointers");
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+	public:
+		WorkStealingDeque() = default;
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/**
+		 * @brief Pushes an item at the bottom, must only be called by the owning thread
+		 * @param item The item to push
+		 * @return False if the deque is full
+		 */
+		bool Push(T item) {
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			int64_t top = m_top.load(std::memory_order_acquire);
+			if (bottom - top >= static_cast<int64_t>(Capacity)) {
+				return false;
+			}
+			m_items[bottom & (Capacity - 1)].store(item, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Pops the newest item from the bottom, must only be called by the owning thread
+		 * @return The item, or a null pointer if the deque is empty or a thief took the last item
+		 */
+		T Pop() {
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_relaxed);
+			// Orders the claim on the bottom item before reading top, pairs with the fence in Steal
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_top.load(std::memory_order_relaxed);
+
+			if (top > bottom) {
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T item = m_items[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (top == bottom) {
+				// The last item, thieves may be after it too
+				if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					item = nullptr;
+				}
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+		/**
+		 * @brief Steals the oldest item from the top, safe to call from any thread
+		 * @return The item, or a null pointer if the deque is empty or another thread got the item first
+		 */
+		T Steal() {
+			int64_t top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_bottom.load(std::memory_order_acquire);
+			if (top >= bottom) {
+				return nullptr;
+			}
+
+			T item = m_items[top & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return nullptr;
+			}
+			return item;
+		}
+
+		/**
+		 * @brief Gets the number of items, only exact when no other thread is using the deque
+		 */
+		size_t Size() const {
+			int64_t size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+			return size > 0 ? static_cast<size_t>(size) : 0;
+		}
+
+	private:
+		// Thieves only touch top, the owner mostly bottom, so they live on separate cache lines
+		alignas(64) std::atomic<int64_t> m_top = 0;
+		alignas(64) std::atomic<int64_t> m_bottom = 0;
+		std::array<std::atomic<T>, Capacity> m_items{};
+	};
+} // namespace IneptEngine::Core
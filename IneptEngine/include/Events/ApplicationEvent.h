@@ -10,10 +10,15 @@ namespace IneptEngine::Events {
 	 */
 	class AppTickEvent : public Event {
 	public:
+		/**
+		 * @brief The EventType every AppTickEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::AppTick;
+
 		/**
 		 * @brief Constructor
 		 */
-		AppTickEvent() : Event(EventType::AppTick, EventCategory::Application) {}
+		AppTickEvent() : Event(StaticType, EventCategory::Application) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -35,10 +40,15 @@ namespace IneptEngine::Events {
 	 */
 	class AppUpdateEvent : public Event {
 	public:
+		/**
+		 * @brief The EventType every AppUpdateEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::AppUpdate;
+
 		/**
 		 * @brief Constructor
 		 */
-		AppUpdateEvent() : Event(EventType::AppUpdate, EventCategory::Application) {}
+		AppUpdateEvent() : Event(StaticType, EventCategory::Application) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -60,10 +70,15 @@ namespace IneptEngine::Events {
 	 */
 	class AppRenderEvent : public Event {
 	public:
+		/**
+		 * @brief The EventType every AppRenderEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::AppRender;
+
 		/**
 		 * @brief Constructor
 		 */
-		AppRenderEvent() : Event(EventType::AppRender, EventCategory::Application) {}
+		AppRenderEvent() : Event(StaticType, EventCategory::Application) {}
 
 		/**
 		 * @fn std::string ToString() const
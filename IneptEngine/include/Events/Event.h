@@ -2,7 +2,9 @@
 
 #include <Events/EventBus.h>
 
-#define TIME_NOW std::chrono::system_clock::now()
+#include <Core/Clock.h>
+
+#define TIME_NOW IneptEngine::Core::Clock::Now()
 
 namespace IneptEngine::Events {
 	/**
@@ -74,6 +76,11 @@ namespace IneptEngine::Events {
 			m_timestamp = TIME_NOW;
 		}
 
+		/**
+		  @brief Virtual destructor so events can be destroyed through a base pointer
+		 */
+		virtual ~Event() = default;
+
 		/**
 		 @fn EventType GetType() const
 		 @brief Gets the type of the event
@@ -88,17 +95,27 @@ namespace IneptEngine::Events {
 		 */
 		EventCategory GetCategory() const { return m_category; }
 
+		/**
+		  @fn Core::Clock::Ticks GetTimestamp() const
+		  @brief Gets the time the event was created
+		  @return The engine clock ticks at which the event was created
+		 */
+		Core::Clock::Ticks GetTimestamp() const { return m_timestamp; }
+
+		/**
+		  @fn void SetTimestamp(Core::Clock::Ticks timestamp)
+		  @brief Sets the time the event was created, used when a stored event is published again
+		  @param timestamp The new timestamp in engine clock ticks
+		 */
+		void SetTimestamp(Core::Clock::Ticks timestamp) { m_timestamp = timestamp; }
+
 		/**
 		@fn std::string GetTime() const
 		@brief Returns the timestamp of the event as a string.
-		@return The timestamp of the event as a string.
+		@return The local time the event was created, e.g 14:03:27.512
 		*/
 		std::string GetTime() const {
-			std::stringstream ss;
-			using namespace std::chrono;
-			zoned_time zt(current_zone(), m_timestamp);
-			ss << std::format("{:%T}", zt);
-			return ss.str();
+			return Core::Clock::FormatTime(m_timestamp);
 		}
 
 		/**
@@ -198,7 +215,7 @@ namespace IneptEngine::Events {
 	private:
 		EventType m_type;
 		EventCategory m_category;
-		std::chrono::system_clock::time_point m_timestamp;
+		Core::Clock::Ticks m_timestamp;
 	};
 
 } // namespace IneptEngine::Events
\ No newline at end of file
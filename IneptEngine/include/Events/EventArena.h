@@ -0,0 +1,110 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @class EventArena
+    * @brief Fixed size bump allocator that events are constructed in for the duration of a frame
+    *
+    * Allocation is a single atomic add, so any thread may allocate concurrently. The arena keeps count of the
+    * allocations still alive, and can only be reset once every event allocated from it has been released.
+    * The live count and the bump offset share one atomic word, so a reset can never race with an allocation.
+    */
+    class EventArena {
+    public:
+        /**
+         * @brief Alignment of every allocation made from the arena
+         */
+        static constexpr size_t Alignment = alignof(std::max_align_t);
+
+        /**
+         * @brief Constructs an arena and allocates its backing memory
+         * @param capacity The size of the arena in bytes
+         */
+        explicit EventArena(size_t capacity) :
+            m_buffer(new std::max_align_t[(capacity + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]),
+            m_capacity(capacity) {}
+
+        EventArena(const EventArena&) = delete;
+        EventArena& operator=(const EventArena&) = delete;
+
+        /**
+         * @brief Allocates memory for an event, safe to call from any thread
+         * @param size The size of the allocation in bytes
+         * @return A pointer to the allocated memory, or nullptr if the arena is full
+         */
+        void* Allocate(size_t size) {
+            uint64_t alignedSize = (size + Alignment - 1) & ~(Alignment - 1);
+            uint64_t previous = m_state.fetch_add(LiveIncrement + alignedSize, std::memory_order_acq_rel);
+            uint64_t end = (previous & OffsetMask) + alignedSize;
+            if (end > m_capacity) {
+                m_state.fetch_sub(LiveIncrement, std::memory_order_acq_rel);
+                return nullptr;
+            }
+
+            uint64_t highWaterMark = m_highWaterMark.load(std::memory_order_relaxed);
+            while (end > highWaterMark && !m_highWaterMark.compare_exchange_weak(highWaterMark, end, std::memory_order_relaxed)) {
+            }
+            return reinterpret_cast<std::byte*>(m_buffer.get()) + (end - alignedSize);
+        }
+
+        /**
+         * @brief Marks an allocation made from this arena as no longer in use
+         */
+        void Release() {
+            m_state.fetch_sub(LiveIncrement, std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief Checks if a pointer lies inside the memory of this arena
+         * @param pointer The pointer to check
+         * @return True if the pointer was allocated from this arena
+         */
+        bool Owns(const void* pointer) const {
+            const std::byte* begin = reinterpret_cast<const std::byte*>(m_buffer.get());
+            const std::byte* address = static_cast<const std::byte*>(pointer);
+            return address >= begin && address < begin + m_capacity;
+        }
+
+        /**
+         * @brief Rewinds the arena to its start if no allocation from it is still alive
+         * @return True if the arena was reset
+         */
+        bool TryReset() {
+            uint64_t state = m_state.load(std::memory_order_acquire);
+            if ((state >> LiveShift) != 0) {
+                return false;
+            }
+            return m_state.compare_exchange_strong(state, 0, std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief The size of the arena in bytes
+         */
+        size_t GetCapacity() const { return m_capacity; }
+
+        /**
+         * @brief The largest number of bytes that were in use at once
+         */
+        size_t GetHighWaterMark() const { return static_cast<size_t>(m_highWaterMark.load(std::memory_order_relaxed)); }
+
+        /**
+         * @brief Resets the high water mark
+         */
+        void ResetHighWaterMark() { m_highWaterMark.store(0, std::memory_order_relaxed); }
+
+    private:
+        // The low bits of the state hold the bump offset, the high bits the number of live allocations
+        static constexpr uint64_t LiveShift = 40;
+        static constexpr uint64_t LiveIncrement = uint64_t(1) << LiveShift;
+        static constexpr uint64_t OffsetMask = LiveIncrement - 1;
+
+        std::unique_ptr<std::max_align_t[]> m_buffer;
+        size_t m_capacity;
+
+        std::atomic<uint64_t> m_state = 0;
+        std::atomic<uint64_t> m_highWaterMark = 0;
+    };
+} // namespace IneptEngine::Events
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Events/EventBus.h>
+#include <Events/EventChannel.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @class EventBridge
+    * @brief Connects the EventBus of this process to the EventBus of another process through an EventChannel
+    *
+    * Events of the selected categories dispatched on the local bus are sent through the channel, and events received
+    * from the channel are published on the local bus by Poll. Events published by Poll are never sent back, so both
+    * processes can forward the same categories.
+    */
+    class EventBridge {
+    public:
+        /**
+         * @brief Starts forwarding events to an open channel
+         * @param channel The channel to the other process, must outlive the bridge
+         * @param categories Bitmask of the event categories to send to the other process
+         */
+        EventBridge(EventChannel& channel, EventCategory categories);
+
+        EventBridge(const EventBridge&) = delete;
+        EventBridge& operator=(const EventBridge&) = delete;
+
+        /**
+         * @brief Publishes the events received from the other process on the local bus
+         *
+         * The events are dispatched immediately with their original timestamps, as by EventBus::PublishNow.
+         * Call it once per frame from one thread, typically the main thread before EventBus::ProcessEvents.
+         *
+         * @return The number of events received
+         */
+        size_t Poll();
+
+        /**
+         * @brief The number of events sent to the other process
+         */
+        size_t GetSentCount() const { return m_sentCount.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief The number of events received from the other process
+         */
+        size_t GetReceivedCount() const { return m_receivedCount; }
+
+    private:
+        /**
+         * @brief Sends a dispatched event to the other process, unless Poll is publishing it on this thread
+         * @param event The dispatched event
+         */
+        void Forward(Event& event);
+
+        EventChannel& m_channel;
+        std::atomic<size_t> m_sentCount = 0;
+        size_t m_receivedCount = 0;
+        SubscriptionToken m_subscription;
+    };
+} // namespace IneptEngine::Events
@@ -2,11 +2,24 @@
 
 #include <iepch.h>
 
+#include <Core/InplaceFunction.h>
+#include <Core/EpochDomain.h>
+#include <Core/JobSystem.h>
+#include <Core/MemoryTracker.h>
+#include <Core/ThreadNodeList.h>
+
 #include <Events/Event.h>
+#include <Events/EventQueue.h>
+#include <Events/EventArena.h>
+#include <Events/Subscription.h>
 #include <Events/ApplicationEvent.h>
 #include <Events/WindowEvent.h>
 #include <Events/KeyboardEvent.h>
 #include <Events/MouseEvent.h>
+#include <Events/EventVariant.h>
+#include <Events/EventJournal.h>
+#include <Events/EventStats.h>
+#include <Events/TimerWheel.h>
 
 #define EVENT_SUBSCRIBE(eventType, eventHandler) \
     IneptEngine::Events::EventBus::GetInstance().Subscribe(IneptEngine::Events::EventType::eventType,std::bind(eventHandler, std::placeholders::_1))
@@ -14,11 +27,24 @@
 #define EVENT_SUBSCRIBE_CATEGORY(eventCategory, eventHandler) \
     IneptEngine::Events::EventBus::GetInstance().Subscribe(IneptEngine::Events::EventCategory::eventCategory, std::bind(eventHandler, std::placeholders::_1))
 
+#define EVENT_SUBSCRIBE_TYPED(eventType, eventHandler) \
+    IneptEngine::Events::EventBus::GetInstance().Subscribe<IneptEngine::Events::eventType>(eventHandler)
+
+#define EVENT_SUBSCRIBE_CONCURRENT(eventType, eventHandler) \
+    IneptEngine::Events::EventBus::GetInstance().SubscribeConcurrent<IneptEngine::Events::eventType>(eventHandler)
+
 #define EVENT_PUBLISH(eventType, ...) \
-    IneptEngine::Events::EventBus::GetInstance().Publish(IneptEngine::Events::EventPtr(new IneptEngine::Events::eventType(__VA_ARGS__)))
+    IneptEngine::Events::EventBus::GetInstance().Publish<IneptEngine::Events::eventType>(__VA_ARGS__)
 
 #define EVENT_PUBLISH_NOW(eventType, ...) \
-    IneptEngine::Events::EventBus::GetInstance().PublishNow(IneptEngine::Events::EventPtr(new IneptEngine::Events::eventType(__VA_ARGS__)))
+    IneptEngine::Events::EventBus::GetInstance().PublishNow<IneptEngine::Events::eventType>(__VA_ARGS__)
+
+// The delay or period is passed first, followed by the arguments of the event constructor
+#define EVENT_PUBLISH_AFTER(eventType, ...) \
+    IneptEngine::Events::EventBus::GetInstance().PublishAfter<IneptEngine::Events::eventType>(__VA_ARGS__)
+
+#define EVENT_PUBLISH_EVERY(eventType, ...) \
+    IneptEngine::Events::EventBus::GetInstance().PublishEvery<IneptEngine::Events::eventType>(__VA_ARGS__)
 
 #define EVENT_PROCESS() \
     IneptEngine::Events::EventBus::GetInstance().ProcessEvents()
@@ -30,20 +56,120 @@
 namespace IneptEngine::Events
 {
     /**
-    * @brief Represents a subscription to an event type or category
+    * @brief Destroys an event, returning its memory to the EventBus frame arena it was allocated from
     */
-    using EventPtr = std::unique_ptr<Event>;
+    struct EventDeleter {
+        void operator()(Event* event) const;
+    };
+
+    using EventPtr = std::unique_ptr<Event, EventDeleter>;
     using EventHandler = std::function<void(Event*)>;
-    struct Subscription {
-    public:
-        EventType type;
-        EventCategory category;
-        EventHandler handler;
-        Subscription(EventType type, EventCategory category, EventHandler handler) :type(type), category(category), handler(handler) {}
 
-        bool operator==(const Subscription& other) const {
-            return (type == other.type) && (category == other.category) && (handler.target<EventHandler>() == other.handler.target<EventHandler>());
-        }
+    /**
+    * @brief Handler as stored by the EventBus, large enough to hold a std::function inline
+    */
+    using InlineEventHandler = Core::InplaceFunction<void(Event&), 64>;
+
+    /**
+    * @brief Options for how the handler of a subscription is called
+    */
+    enum class SubscriptionFlags : uint32_t {
+        None = 0,
+
+        /**
+         * The handler is thread-safe and is called on a JobSystem worker during ProcessEvents, concurrently with other handlers.
+         * It still receives the events of a frame one at a time and in order. Set by SubscribeConcurrent.
+         */
+        Concurrent = 1 << 0
+    };
+
+    /**
+    * @brief How the EventBus stores events published with Publish<T>
+    */
+    enum class EventStorageMode {
+        /**
+         * Events are allocated individually in the frame arena and stored as EventPtr.
+         */
+        Polymorphic,
+
+        /**
+         * Events are stored by value as an EventVariant in a contiguous buffer and dispatched with std::visit.
+         */
+        Contiguous
+    };
+
+    /**
+    * @brief How the EventBus combines events of one type that are published before the next ProcessEvents
+    */
+    enum class CoalescingPolicy {
+        /**
+         * Every event is queued and dispatched.
+         */
+        KeepAll,
+
+        /**
+         * Only one event is dispatched per frame, holding the values of the latest published event.
+         */
+        KeepLatest,
+
+        /**
+         * Only one event is dispatched per frame, each published event is merged into it by a merge function, e.g summing scroll offsets.
+         */
+        Accumulate
+    };
+
+    /**
+    * @brief Merges an incoming event into the event already queued this frame, both are of the same type
+    */
+    using EventMerger = Core::InplaceFunction<void(Event& pending, const Event& incoming)>;
+
+    /**
+    * @brief Counters describing how many published events were merged into an already queued event
+    */
+    struct EventCoalescingStats {
+        size_t mergedCount;
+    };
+
+    /**
+    * @brief Counters describing how full the EventBus publish buffers get, capacity and depth are per publishing thread
+    */
+    struct EventQueueStats {
+        size_t capacity;
+        size_t highWaterMark;
+        size_t overflowCount;
+    };
+
+    /**
+    * @brief Counters describing how much of the EventBus frame arenas is used
+    */
+    struct EventArenaStats {
+        size_t capacity;
+        size_t highWaterMark;
+        size_t heapFallbackCount;
+    };
+
+    /**
+    * @brief Everything the EventBus measures, returned by EventBus::GetStats
+    */
+    struct EventBusStats {
+        /**
+         * @brief Latency and handler timings of every event type that was dispatched
+         */
+        std::vector<EventTypeStats> types;
+
+        /**
+         * @brief Timings of every active subscription, the handler taking the most time first
+         */
+        std::vector<EventHandlerStats> handlers;
+
+        /**
+         * @brief Number of events dispatched by each ProcessEvents call
+         */
+        EventHistogramSnapshot eventsPerFrame;
+
+        EventQueueStats queue;
+        EventArenaStats arena;
+        EventCoalescingStats coalescing;
     };
 
     /**
@@ -55,6 +181,9 @@ namespace IneptEngine::Events
     * publishes events to all subscribed handlers.
     *
     * The class is designed to be thread-safe, so that it can be used in a multithreaded environment.
+    * Dispatch reads an immutable snapshot of the subscriber lists without taking a lock, subscribing and unsubscribing
+    * publish a new snapshot, and old snapshots are freed once no dispatch can still be reading them.
+    * Every publishing thread writes to its own event buffers, which ProcessEvents merges in timestamp order.
     */
 
     class EventBus {
@@ -74,11 +203,14 @@ namespace IneptEngine::Events
          * This function subscribes a specified event handler function to a specific event type.
          * The handler will be called whenever an event of the specified type is published to the bus.
          *
+         * If an owner is passed and it is already subscribed to the type, no new subscription is made and an empty token is returned.
+         *
          * @param type The event type to subscribe to
          * @param handler The event handler function
-         * @return A reference to a subscription that can be used to unsubscribe the event handler
+         * @param owner Optional owner used to detect duplicate subscriptions
+         * @return A token that unsubscribes the event handler when destroyed
          */
-        Subscription& Subscribe(EventType type, EventHandler handler);
+        SubscriptionToken Subscribe(EventType type, EventHandler handler, const void* owner = nullptr);
 
         /**
          * @brief Subscribes a function to an event category
@@ -86,75 +218,949 @@ namespace IneptEngine::Events
          * This function subscribes a specified event handler function to a specific event category.
          * The handler will be called whenever an event of the specified category is published to the bus.
          *
+         * If an owner is passed and it is already subscribed to the category, no new subscription is made and an empty token is returned.
+         *
          * @param category The event category to subscribe to
          * @param handler The event handler function
-         * @return A reference to a subscription object that can be used to unsubscribe the event handler
+         * @param owner Optional owner used to detect duplicate subscriptions
+         * @return A token that unsubscribes the event handler when destroyed
+         */
+        SubscriptionToken Subscribe(EventCategory category, EventHandler handler, const void* owner = nullptr);
+
+        /**
+         * @brief Subscribes a handler to a concrete event class
+         *
+         * The event type is resolved at compile time and the handler receives the concrete event, so no cast is needed.
+         * The handler is stored inline without allocating, and is called directly when the event is dispatched.
+         *
+         * @tparam T The concrete event class to subscribe to, e.g KeyPressedEvent
+         * @param handler A callable taking T&
+         * @param owner Optional owner used to detect duplicate subscriptions
+         * @return A token that unsubscribes the event handler when destroyed
+         */
+        template<typename T, typename Handler>
+        SubscriptionToken Subscribe(Handler&& handler, const void* owner = nullptr) {
+            static_assert(IsEventVariantAlternativeV<T>, "Typed subscriptions require a concrete event class");
+            static_assert(std::is_invocable_v<std::decay_t<Handler>&, T&>, "Handler must be callable with the event class");
+
+            return AddSubscription(EventTypeOf<T>, EventCategory::None, InlineEventHandler([handler = std::forward<Handler>(handler)](Event& event) mutable {
+                handler(static_cast<T&>(event));
+                }), owner, SubscriptionFlags::None);
+        }
+
+        /**
+         * @brief Subscribes a thread-safe handler to a concrete event class, called on the JobSystem during ProcessEvents
+         *
+         * The handler runs concurrently with the main-thread handlers and other concurrent handlers, so it only gets read
+         * access to the event. It receives an event once the main-thread handlers have finished with it.
+         *
+         * @tparam T The concrete event class to subscribe to, e.g KeyPressedEvent
+         * @param handler A thread-safe callable taking const T&
+         * @param owner Optional owner used to detect duplicate subscriptions
+         * @return A token that unsubscribes the event handler when destroyed
          */
-        Subscription& Subscribe(EventCategory category, EventHandler handler);
+        template<typename T, typename Handler>
+        SubscriptionToken SubscribeConcurrent(Handler&& handler, const void* owner = nullptr) {
+            static_assert(IsEventVariantAlternativeV<T>, "Typed subscriptions require a concrete event class");
+            static_assert(std::is_invocable_v<std::decay_t<Handler>&, const T&>, "Handler must be callable with the const event class");
+
+            return AddSubscription(EventTypeOf<T>, EventCategory::None, InlineEventHandler([handler = std::forward<Handler>(handler)](Event& event) mutable {
+                handler(static_cast<const T&>(event));
+                }), owner, SubscriptionFlags::Concurrent);
+        }
 
         /**
-         * @brief Check if function has been subscribed to an event type
+         * @brief Check if a subscription is still active
          *
-         * This function will check if the specified handler function has been already subscribed to a specific event type.
+         * @param handle The handle of the subscription
+         * @return Boolean value indicating if the subscription is active or not
+         */
+        bool IsSubscribed(SubscriptionHandle handle);
+
+        /**
+         * @brief Check if an owner has been subscribed to an event type
          *
+         * @param owner The owner passed when subscribing
          * @param type The event type to check for
-         * @param handler The event handler function
-         * @return Boolean value indicating if handler is subscribed or not
+         * @return Boolean value indicating if the owner is subscribed or not
          */
-        bool IsSubscribed(EventType type, EventHandler handler);
+        bool IsSubscribed(const void* owner, EventType type);
+
+        /**
+         * @brief Check if an owner has been subscribed to an event category
+         *
+         * @param owner The owner passed when subscribing
+         * @param category The event category to check for
+         * @return Boolean value indicating if the owner is subscribed or not
+         */
+        bool IsSubscribed(const void* owner, EventCategory category);
 
         /**
          * @brief Unsubscribes a function from an event type or category
          *
-         * This function removes the specified event handler function from the list of subscribers.
-         * The function will no longer receive events of the specified type or category.
+         * This function removes the specified event handler function from the list of subscribers in constant time.
+         * The function will no longer receive events of the specified type or category. It is removed from the subscriber
+         * lists the next time events are processed, and the handler is destroyed once no dispatch can still be calling it,
+         * so a handler may safely unsubscribe itself.
+         * If the handler is running on other threads, e.g as a concurrent subscriber, this function waits for those calls
+         * to return, so whatever the handler uses can be destroyed once it returns.
+         * Usually called by SubscriptionToken rather than directly.
+         *
+         * @param handle The handle of the subscription to unsubscribe
+         */
+        void Unsubscribe(SubscriptionHandle handle);
+
+        /**
+         * @brief Gets the number of active subscriptions
+         * @return The number of active subscriptions
+         */
+        size_t GetSubscriberCount();
+
+        /**
+         * @brief Creates an event in the frame arena of the EventBus
+         *
+         * Events are constructed in one of two arenas that alternate every time ProcessEvents is called, so publishing
+         * an event does not touch the global heap. An arena is reset once every event allocated from it has been
+         * destroyed. If the current arena is full the event is allocated on the heap instead.
+         *
+         * @tparam T The type of the event to create
+         * @param args The arguments passed to the event constructor
+         * @return The created event
+         */
+        template<typename T, typename... Args>
+        EventPtr MakeEvent(Args&&... args) {
+            static_assert(std::is_base_of_v<Event, T>, "MakeEvent can only create events");
+            static_assert(alignof(T) <= EventArena::Alignment, "Event alignment is larger than the arena alignment");
+
+            EventArena* arena = m_publishArena.load(std::memory_order_acquire);
+            if (void* memory = arena->Allocate(sizeof(T))) {
+                return EventPtr(new (memory) T(std::forward<Args>(args)...));
+            }
+
+            m_arenaHeapFallbackCount.fetch_add(1, std::memory_order_relaxed);
+            MEMORY_TAG_SCOPE(Events);
+            return EventPtr(new T(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Destroys an event, called by EventPtr
+         *
+         * Events allocated from a frame arena are destructed and released back to the arena, others are deleted.
          *
-         * @param subscription The subscription object to unsubscribe
+         * @param event The event to destroy
          */
-        void Unsubscribe(const Subscription& subscription);
+        void DestroyEvent(Event* event);
 
         /**
          * @brief Publishes an event to the event buffer
          *
-         * This function adds the specified event to the event buffer, to be processed by all subscribers at a later time.
+         * This function adds the specified event to the event buffer of the calling thread, to be processed by all subscribers at a later time.
+         * It is lock-free and can be called from any thread. If the buffer is full the event is kept in an overflow list
+         * instead, which is the only case where a lock is taken.
          *
          * @param event The event to publish
          */
         void Publish(EventPtr event);
 
+        /**
+         * @brief Publishes an event stored by value to the event buffer
+         *
+         * This function adds the specified event to the contiguous event buffer of the calling thread, to be processed by all subscribers at a later time.
+         * Like Publish(EventPtr) it is lock-free unless the buffer overflows.
+         *
+         * @param event The event to publish
+         */
+        void Publish(EventVariant event);
+
+        /**
+         * @brief Constructs and publishes an event to the event buffer
+         *
+         * Depending on the storage mode the event is either created in the frame arena or stored by value.
+         *
+         * @tparam T The type of the event to publish
+         * @param args The arguments passed to the event constructor
+         */
+        template<typename T, typename... Args>
+        void Publish(Args&&... args) {
+            if constexpr (IsEventVariantAlternativeV<T>) {
+                // Coalesced events are merged on the stack when possible, and otherwise created in the arena so later events can be merged into them
+                constexpr size_t type = static_cast<size_t>(EventTypeOf<T>);
+                if (IsCoalesced(type)) {
+                    T event(std::forward<Args>(args)...);
+                    if (IsJournaling() && !JournalQueued(event)) {
+                        return;
+                    }
+                    if (!Coalesce(type, event, nullptr)) {
+                        EnqueueEvent(MakeEvent<T>(std::move(event)));
+                    }
+                    return;
+                }
+
+                if (m_storageMode.load(std::memory_order_relaxed) == EventStorageMode::Contiguous) {
+                    Publish(EventVariant(std::in_place_type<T>, std::forward<Args>(args)...));
+                    return;
+                }
+            }
+            Publish(MakeEvent<T>(std::forward<Args>(args)...));
+        }
+
         /**
          * @brief Publishes an event to the subscriptions now
          *
-         * This function immediately calls the subscribed event handler functions for the passed event.
+         * This function immediately calls the subscribed event handler functions for the passed event on the calling thread,
+         * including handlers subscribed with SubscribeConcurrent.
          * This can be useful if you need the event handlers to be called immediately and don't want to wait for the event buffer to be processed.
          *
          * @param event The event to publish
          */
         void PublishNow(EventPtr event);
 
+        /**
+         * @brief Constructs an event on the stack and publishes it to the subscriptions now
+         *
+         * @tparam T The type of the event to publish
+         * @param args The arguments passed to the event constructor
+         */
+        template<typename T, typename... Args>
+        void PublishNow(Args&&... args) {
+            T event(std::forward<Args>(args)...);
+            if (IsJournaling()) {
+                // While replaying, the recorded event is dispatched in place of the live one
+                if (Event* journaledEvent = JournalImmediate(event)) {
+                    DispatchNow(static_cast<size_t>(journaledEvent->GetType()), *journaledEvent);
+                }
+                return;
+            }
+            if constexpr (IsEventVariantAlternativeV<T>) {
+                DispatchNow(static_cast<size_t>(EventTypeOf<T>), event);
+            }
+            else {
+                DispatchNow(static_cast<size_t>(event.GetType()), event);
+            }
+        }
+
+        /**
+         * @brief Publishes an event once a delay has passed
+         *
+         * The event is constructed now and kept in the timer wheel of the EventBus. It is fired by the first ProcessEvents
+         * after the delay, at the start of the frame, and dispatched with the events published that frame. Timer events are
+         * never coalesced. Can be called from any thread.
+         *
+         * @tparam T The concrete event class to publish
+         * @param delay The time to wait before publishing, rounded to TimerResolution
+         * @param args The arguments passed to the event constructor
+         * @return The handle of the timer, to cancel it with CancelTimer
+         */
+        template<typename T, typename... Args>
+        TimerHandle PublishAfter(std::chrono::milliseconds delay, Args&&... args) {
+            static_assert(IsEventVariantAlternativeV<T>, "Scheduled events require a concrete event class");
+            return ScheduleTimer(delay, std::chrono::milliseconds(0), EventVariant(std::in_place_type<T>, std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Publishes an event at a fixed rate until the timer is cancelled
+         *
+         * The event is published for the first time after one period. The rate does not drift with the frame rate, if a frame
+         * takes longer than a period the event is published once for every period that passed.
+         *
+         * @tparam T The concrete event class to publish
+         * @param period The time between two publishes, at least TimerResolution
+         * @param args The arguments passed to the event constructor
+         * @return The handle of the timer, to cancel it with CancelTimer
+         */
+        template<typename T, typename... Args>
+        TimerHandle PublishEvery(std::chrono::milliseconds period, Args&&... args) {
+            static_assert(IsEventVariantAlternativeV<T>, "Scheduled events require a concrete event class");
+            period = (std::max)(period, TimerResolution);
+            return ScheduleTimer(period, period, EventVariant(std::in_place_type<T>, std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Cancels an event scheduled with PublishAfter or PublishEvery in constant time
+         * @param handle The handle of the timer
+         * @return True if the timer was pending and its event will not be published anymore
+         */
+        bool CancelTimer(TimerHandle handle);
+
+        /**
+         * @brief Checks if a scheduled event is still waiting to be published
+         * @param handle The handle of the timer
+         */
+        bool IsTimerPending(TimerHandle handle);
+
+        /**
+         * @brief Gets the number of scheduled events waiting to be published
+         */
+        size_t GetPendingTimerCount();
+
+        /**
+         * @brief Sets how events published with Publish<T> are stored
+         *
+         * Events already in the event buffer are still processed after the mode changes.
+         *
+         * @param mode The storage mode to use
+         */
+        void SetStorageMode(EventStorageMode mode) { m_storageMode.store(mode, std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets how events published with Publish<T> are stored
+         * @return The current storage mode
+         */
+        EventStorageMode GetStorageMode() const { return m_storageMode.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Sets how events of a type published before the next ProcessEvents are combined
+         *
+         * Coalescing happens when an event is published. The first event of a coalesced type in a frame is queued, later events
+         * of that type are merged into it and not queued, so the merged event is dispatched once at the position of the first.
+         * Events published with PublishNow are never coalesced. By default WindowResize, WindowMoved and MouseMoved keep the latest
+         * event, and MouseScrolled accumulates its offsets.
+         *
+         * @tparam T The concrete event class to set the policy for
+         * @param policy KeepAll or KeepLatest, Accumulate requires the overload taking a merge function
+         */
+        template<typename T>
+        void SetCoalescingPolicy(CoalescingPolicy policy) {
+            static_assert(IsEventVariantAlternativeV<T>, "Coalescing policies require a concrete event class");
+
+            EventMerger merger;
+            if (policy == CoalescingPolicy::KeepLatest) {
+                merger = EventMerger([](Event& pending, const Event& incoming) {
+                    static_cast<T&>(pending) = static_cast<const T&>(incoming);
+                    });
+            }
+            SetCoalescingPolicy(EventTypeOf<T>, policy, std::move(merger));
+        }
+
+        /**
+         * @brief Accumulates events of a type published before the next ProcessEvents into one event
+         *
+         * @tparam T The concrete event class to set the policy for
+         * @param merge A callable taking (T& pending, const T& incoming) that merges the incoming event into the queued one
+         */
+        template<typename T, typename Merge>
+        void SetCoalescingPolicy(Merge&& merge) {
+            static_assert(IsEventVariantAlternativeV<T>, "Coalescing policies require a concrete event class");
+            static_assert(std::is_invocable_v<std::decay_t<Merge>&, T&, const T&>, "Merge must be callable with (T&, const T&)");
+
+            SetCoalescingPolicy(EventTypeOf<T>, CoalescingPolicy::Accumulate, EventMerger([merge = std::forward<Merge>(merge)](Event& pending, const Event& incoming) mutable {
+                merge(static_cast<T&>(pending), static_cast<const T&>(incoming));
+                }));
+        }
+
+        /**
+         * @brief Gets how events of a type are combined before being dispatched
+         * @param type The event type
+         * @return The coalescing policy of the type
+         */
+        CoalescingPolicy GetCoalescingPolicy(EventType type) const;
+
+        /**
+         * @brief Returns how many published events were merged into an already queued event
+         * @return The total coalescing counters
+         */
+        EventCoalescingStats GetCoalescingStats() const;
+
+        /**
+         * @brief Returns how many published events of a type were merged into an already queued event
+         * @param type The event type
+         * @return The number of merged events
+         */
+        size_t GetMergedCount(EventType type) const;
+
+        /**
+         * @brief Resets the merged event counters
+         */
+        void ResetCoalescingStats();
+
         /**
          * @brief Process the events in the event buffer
          *
          * This function processes all events in the event buffer, calling all subscribed event handlers for each event.
          * After processing all events, the event buffer is cleared.
+         * Events fired by timers are dispatched first, in the order they fired. The published events of the frame follow in
+         * one list, whether they were stored in the arena or by value, ordered by event timestamp. Events with the same
+         * timestamp are ordered by the id of the buffer of their thread, then by the order that thread published them in.
+         * Buffer ids are handed out in the order threads first published in, which can change between runs, so only the
+         * order of events of one thread or with different timestamps is reproducible.
+         * Events processed while nothing is subscribed are dropped instead of being kept for a later subscriber.
+         * It must only be called from one thread, typically the main thread, and never blocks publishers.
+         * Handlers subscribed with SubscribeConcurrent run on the JobSystem meanwhile, each event once the main-thread handlers
+         * have finished with it, and have finished when it returns.
          *
          */
         void ProcessEvents();
+
+        /**
+         * @brief Starts recording every published event to a binary journal file
+         *
+         * Events are recorded as they are published, with Publish, PublishNow or by a timer firing, together with the
+         * number of the frame they are dispatched in, counted from the first ProcessEvents after recording starts. Events
+         * published to the event buffer are recorded before they are coalesced. Must be called from the thread that
+         * processes events.
+         *
+         * @param path The path of the journal file, it is overwritten
+         * @return True if recording started
+         */
+        bool StartRecording(const std::string& path);
+
+        /**
+         * @brief Stops recording and closes the journal file
+         */
+        void StopRecording();
+
+        /**
+         * @brief Checks if events are being recorded
+         */
+        bool IsRecording() const { return m_journalMode.load(std::memory_order_relaxed) == JournalMode::Recording; }
+
+        /**
+         * @brief Starts replaying a journal recorded with StartRecording
+         *
+         * The journal takes the place of everything published to the bus, e.g by the window, OS input or timers, which is
+         * dropped while replaying:
+         * - Events published to the event buffer are published again at the start of the ProcessEvents of their frame,
+         *   so they are coalesced and dispatched as they were when recording.
+         * - Events of fired timers are dispatched in place of the timers firing in their frame.
+         * - Each PublishNow call dispatches the next event recorded by PublishNow in its frame instead of its own, so
+         *   the synchronous events stay where the application dispatches them. Recorded events no PublishNow call was
+         *   left for are dispatched at the start of the next ProcessEvents.
+         *
+         * Replay stops by itself after the last recorded frame. Must be called from the thread that processes events,
+         * which is also the only thread PublishNow replays events on.
+         *
+         * @param path The path of the journal file
+         * @return True if replay started
+         */
+        bool StartReplay(const std::string& path);
+
+        /**
+         * @brief Stops replaying, published events are dispatched again from the next ProcessEvents
+         */
+        void StopReplay();
+
+        /**
+         * @brief Checks if a journal is being replayed
+         */
+        bool IsReplaying() const { return m_journalMode.load(std::memory_order_relaxed) == JournalMode::Replaying; }
+
+        /**
+         * @brief Enables measuring event latency and handler execution times
+         *
+         * While enabled, the time from an event being created to being dispatched and the time of every handler call are
+         * recorded per event type, and per subscription. Measuring adds two clock reads per handler call.
+         *
+         * @param enabled True to start measuring, false to stop
+         */
+        void SetStatsEnabled(bool enabled) { m_statsEnabled.store(enabled, std::memory_order_relaxed); }
+
+        /**
+         * @brief Checks if event latency and handler execution times are measured
+         */
+        bool IsStatsEnabled() const { return m_statsEnabled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Logs the stats from ProcessEvents every time the interval has passed
+         *
+         * A non-zero interval also enables measuring.
+         *
+         * @param interval The time between two dumps, zero to stop dumping
+         */
+        void SetStatsDumpInterval(std::chrono::milliseconds interval);
+
+        /**
+         * @brief Gives a subscription a name to show in the stats
+         * @param handle The handle of the subscription
+         * @param name The name to show
+         */
+        void SetSubscriptionName(SubscriptionHandle handle, std::string name);
+
+        /**
+         * @brief Collects all measured timings and counters
+         * @return The stats since they were last reset
+         */
+        EventBusStats GetStats();
+
+        /**
+         * @brief Logs the measured timings, the event types and handlers taking the most time first
+         */
+        void DumpStats();
+
+        /**
+         * @brief Clears all measured timings and counters
+         */
+        void ResetStats();
+
+        /**
+         * @brief Returns how full the event buffer has become and how often it overflowed
+         * @return The current event queue counters
+         */
+        EventQueueStats GetQueueStats() const;
+
+        /**
+         * @brief Resets the high water mark and overflow counters of the event buffer
+         */
+        void ResetQueueStats();
+
+        /**
+         * @brief Returns how much of the frame arenas is used and how often events fell back to the heap
+         * @return The current frame arena counters
+         */
+        EventArenaStats GetArenaStats() const;
+
+        /**
+         * @brief Resets the high water marks and heap fallback counter of the frame arenas
+         */
+        void ResetArenaStats();
+
+        /**
+         * @brief Size in bytes of each of the two frame arenas events are allocated from
+         */
+        static constexpr size_t EventArenaCapacity = 1 << 20;
+
+        /**
+         * @brief Number of events the lock-free event buffer of each publishing thread holds before publishing overflows
+         */
+        static constexpr size_t EventQueueCapacity = 4096;
+
+        /**
+         * @brief Number of distinct event types, used to size the per-type subscriber tables
+         */
+        static constexpr size_t EventTypeCount = static_cast<size_t>(EventType::MouseScrolled) + 1;
+
+        /**
+         * @brief Number of distinct category bitmasks, used to size the per-category subscriber tables
+         */
+        static constexpr size_t CategoryMaskCount = static_cast<size_t>(EventCategory::MouseButton) << 1;
+
+        /**
+         * @brief Length of one tick of the timer wheel, the precision of scheduled events
+         */
+        static constexpr std::chrono::milliseconds TimerResolution{ 1 };
     private:
         /**
-         * @brief Private constructor to prevent use oustide of singleton
+         * @brief Private constructor to prevent use oustide of singleton, sets the default coalescing policies
+         */
+        EventBus();
+
+        /**
+         * @brief Frees the current subscriber snapshot
+         */
+        ~EventBus();
+
+        /**
+         * @brief Calls every handler subscribed to the type or category of the event
+         *
+         * Type subscribers are called first, followed by category subscribers, each in the order they subscribed.
+         * Concurrent subscribers are not called, they are handed their events by DispatchConcurrent.
+         * Must be called inside a read of the epoch domain.
+         *
+         * @param event The event to dispatch
+         */
+        void Dispatch(Event* event);
+
+        /**
+         * @brief Calls every handler subscribed to the given type or to the category of the event
+         *
+         * @param type The index of the event type, known at compile time when the concrete event class is
+         * @param event The event to dispatch
+         */
+        void Dispatch(size_t type, Event& event);
+
+        /**
+         * @brief Calls every handler subscribed to the given type or to the category of the event, concurrent ones included
+         *
+         * Can be called from any thread, it reads the subscriber snapshot without taking a lock.
+         *
+         * @param type The index of the event type
+         * @param event The event to dispatch
+         */
+        void DispatchNow(size_t type, Event& event);
+
+        struct SubscriberSnapshot;
+        struct SubscriptionSlot;
+
+        /**
+         * @brief Counts a call of the handler of a subscription, unless it has been unsubscribed
+         * @return False if the handler must not be called, otherwise LeaveHandler must follow the call
+         */
+        bool EnterHandler(SubscriptionSlot& slot);
+
+        /**
+         * @brief Ends a call counted by EnterHandler
+         */
+        void LeaveHandler(SubscriptionSlot& slot);
+
+        /**
+         * @brief Calls the handler of a subscription unless it has been unsubscribed, timing it when stats are collected
+         *
+         * @param slot The subscription to call
+         * @param type The index of the event type
+         * @param event The event to pass to the handler
+         */
+        void CallHandler(SubscriptionSlot& slot, size_t type, Event& event);
+
+        /**
+         * @brief Adds the duration of a handler call to the stats of its event type and subscription
+         *
+         * @param slot The subscription that was called
+         * @param type The index of the event type
+         * @param nanoseconds The duration of the call
+         */
+        void RecordHandlerTime(SubscriptionSlot& slot, size_t type, uint64_t nanoseconds);
+
+        /**
+         * @brief Calls the handlers in a set of subscriber lists that are subscribed to the given type or to the category of the event
+         *
+         * @param snapshot The subscriber snapshot to look the handlers up in
+         * @param listSet MainThreadLists or ConcurrentLists
+         * @param type The index of the event type
+         * @param event The event to dispatch
+         */
+        void CallHandlers(const SubscriberSnapshot& snapshot, size_t listSet, size_t type, Event& event);
+
+        /**
+         * @brief Records the depth of an event buffer after a successful push
+         * @param depth The number of events in the buffer
+         */
+        void RecordQueueDepth(size_t depth);
+
+        /**
+         * @brief Stores a subscription in a free slot and adds it to the per-type or per-category subscriber lists
+         *
+         * @param type The event type to subscribe to, or EventType::None for a category subscription
+         * @param category The event category to subscribe to, or EventCategory::None for a type subscription
+         * @param handler The event handler
+         * @param owner Optional owner used to detect duplicate subscriptions
+         * @param flags Options for how the handler is called
+         * @return A token owning the subscription, empty if the owner was already subscribed
+         */
+        SubscriptionToken AddSubscription(EventType type, EventCategory category, InlineEventHandler handler, const void* owner, SubscriptionFlags flags);
+
+        /**
+         * @brief Sets the coalescing policy and merge function of an event type
+         *
+         * @param type The event type
+         * @param policy The coalescing policy
+         * @param merger Merges an incoming event into the queued one, unused for KeepAll
+         */
+        void SetCoalescingPolicy(EventType type, CoalescingPolicy policy, EventMerger merger);
+
+        /**
+         * @brief Checks if events of a type are coalesced, without taking a lock
+         * @param type The index of the event type
          */
-        EventBus() = default;
+        bool IsCoalesced(size_t type) const {
+            return type < EventTypeCount && m_coalescingPolicies[type].load(std::memory_order_relaxed) != CoalescingPolicy::KeepAll;
+        }
+
+        /**
+         * @brief Merges an event into the event of the same type queued this frame, or remembers it as the queued event
+         *
+         * @param type The index of the event type
+         * @param event The published event
+         * @param queued The event about to be queued, remembered if no event of the type is queued yet, may be null
+         * @return True if the event was merged and must not be queued
+         */
+        bool Coalesce(size_t type, const Event& event, Event* queued);
+
+        /**
+         * @brief Forgets the queued event of every coalesced type, later events start a new merged event
+         */
+        void ClearCoalescedEvents();
+
+        /**
+         * @brief Gathers the events of this frame into one batch per concurrent subscriber
+         *
+         * Must be called before the processed events are dispatched on the main thread. The batches are handed to the
+         * JobSystem by ScheduleConcurrentBatches as the main thread finishes the events, and the jobs are waited on
+         * with m_concurrentJobs before the events are destroyed.
+         *
+         * @return True if there are batches, false if there was nothing to dispatch concurrently
+         */
+        bool DispatchConcurrent();
+
+        struct ConcurrentBatch;
+
+        /**
+         * @brief Submits a job for every batch that is not running and has events the main thread has finished with
+         */
+        void ScheduleConcurrentBatches();
+
+        /**
+         * @brief Calls the handler of a batch for its events the main thread has finished with, runs as a job
+         *
+         * @param batch The batch to run, scheduled for this job
+         */
+        void RunConcurrentBatch(ConcurrentBatch& batch);
+
+        /**
+         * @brief Stores an event in the timer wheel
+         *
+         * @param delay The time until the event is first published
+         * @param period The time between two publishes, zero to publish once
+         * @param event The event to publish
+         * @return The handle of the timer
+         */
+        TimerHandle ScheduleTimer(std::chrono::milliseconds delay, std::chrono::milliseconds period, EventVariant event);
 
         /**
-         * @brief Default destructor
+         * @brief Fires the timers that are due and adds their events to the events of this frame
          */
-        ~EventBus() = default;
+        void AdvanceTimers();
+
+        /**
+         * @brief Checks if events are being recorded or replayed, the only case the journal functions are called in
+         */
+        bool IsJournaling() const { return m_journalMode.load(std::memory_order_relaxed) != JournalMode::None; }
+
+        /**
+         * @brief Records an event published to the event buffer
+         * @param event The event
+         * @return False while replaying, the live event is dropped then
+         */
+        bool JournalQueued(const Event& event);
+
+        /**
+         * @brief Records an event dispatched with PublishNow, or swaps it for the next recorded one while replaying
+         * @param event The event
+         * @return The event to dispatch, or a null pointer to drop it
+         */
+        Event* JournalImmediate(Event& event);
+
+        /**
+         * @brief Writes an event to the journal, stopping the recording if the file cannot be grown
+         */
+        void WriteJournal(EventRecordKind kind, const Event& event);
+
+        /**
+         * @brief Replays the recorded events of the frame that is processed, must be called before the shards are drained
+         */
+        void ReplayFrame();
+
+        /**
+         * @brief Reads the recorded events of the next frame, or stops replaying after the last one
+         *
+         * The journal mutex must be held by the caller.
+         */
+        void ReadReplayFrame();
+
+        /**
+         * @brief Adds an event to the event buffer of the calling thread, Publish without the journal
+         */
+        void EnqueueEvent(EventPtr event);
+        void EnqueueEvent(EventVariant event);
+
+        /**
+         * @brief Publishes a new subscriber snapshot built from the current one
+         *
+         * Unsubscribed slots are left out and retired together with the old snapshot. Must be called with the subscriptions mutex held.
+         *
+         * @param added A subscription to add to the lists it belongs to, may be null
+         */
+        void PublishSnapshot(SubscriptionSlot* added);
+
+        /**
+         * @brief Removes unsubscribed slots from the subscriber lists, and frees retired snapshots and slots no dispatch can still be reading
+         *
+         * Must be called with the subscriptions mutex held.
+         */
+        void ReclaimSlots();
+
+        struct PublishShard;
+
+        /**
+         * @brief Gets the event buffers of the calling thread, reusing those of an exited thread or adding new ones on the first publish
+         */
+        PublishShard& GetPublishShard();
+
+        /**
+         * @brief Moves the events published so far from the buffers of every thread to the events of this frame, in merge order
+         */
+        void DrainPublishShards();
+
+        // An event and its position in the order its thread published in
+        template<typename T>
+        struct ShardedEvent {
+            uint64_t sequence = 0;
+            T event;
+        };
+
+        // The event buffers of one publishing thread. Only one thread pushes to a shard at a time, so publishers never
+        // contend on a buffer. A shard is handed to a new thread once its thread has exited, the events left in it are
+        // still dispatched.
+        struct PublishShard {
+            // Only touched by the thread owning the shard
+            uint64_t nextSequence = 0;
+
+            EventQueue<ShardedEvent<EventPtr>, EventQueueCapacity> events;
+            EventQueue<ShardedEvent<EventVariant>, EventQueueCapacity> eventValues;
+
+            std::atomic<bool> overflowPending = false;
+            std::vector<ShardedEvent<EventPtr>> overflowEvents;
+            std::vector<ShardedEvent<EventVariant>> overflowEventValues;
+            std::mutex overflowMutex;
+        };
+
+        // An event of this frame, with the key the events of a frame are sorted by and the index of the event in the
+        // processing events or event values
+        struct MergedEvent {
+            Core::Clock::Ticks timestamp;
+            uint32_t shard;
+            uint64_t sequence;
+            uint32_t index;
+            bool isValue;
+        };
+
+        /**
+         * @brief Returns the stored event a merged event refers to
+         */
+        Event* GetMergedEvent(const MergedEvent& mergedEvent) {
+            return mergedEvent.isValue ? GetEvent(m_processingEventValues[mergedEvent.index]) : m_processingEvents[mergedEvent.index].get();
+        }
+
+        Core::ThreadNodeList<PublishShard> m_publishShards;
+        // The events of this frame in dispatch order, whichever storage mode they were published with
+        std::vector<MergedEvent> m_mergedEvents;
+
+        std::vector<EventPtr> m_processingEvents;
+        std::vector<EventVariant> m_processingEventValues;
+        std::atomic<EventStorageMode> m_storageMode = EventStorageMode::Polymorphic;
+
+        // Events are created in the publish arena, the other arena holds the events of the frame being processed
+        std::array<EventArena, 2> m_arenas{ EventArena(EventArenaCapacity), EventArena(EventArenaCapacity) };
+        std::atomic<EventArena*> m_publishArena = &m_arenas[0];
+        std::atomic<size_t> m_arenaHeapFallbackCount = 0;
+
+        std::atomic<size_t> m_queueHighWaterMark = 0;
+        std::atomic<size_t> m_queueOverflowCount = 0;
+
+        struct CoalescedEvent {
+            CoalescingPolicy policy = CoalescingPolicy::KeepAll;
+            EventMerger merger;
+            Event* pending = nullptr;
+        };
+
+        // The policies are duplicated in atomics, so publishing events that are not coalesced never takes the lock
+        std::array<std::atomic<CoalescingPolicy>, EventTypeCount> m_coalescingPolicies{};
+        std::array<CoalescedEvent, EventTypeCount> m_coalescedEvents;
+        std::array<std::atomic<size_t>, EventTypeCount> m_mergedCounts{};
+        std::mutex m_coalescingMutex;
+
+        struct SubscriptionSlot {
+            uint32_t index = 0;
+            uint32_t generation = 0;
+            std::atomic<bool> active = false;
+            SubscriptionFlags flags = SubscriptionFlags::None;
+            EventType type = EventType::None;
+            EventCategory category = EventCategory::None;
+            const void* owner = nullptr;
+            InlineEventHandler handler;
+
+            std::string name;
+            std::atomic<uint64_t> callCount = 0;
+            std::atomic<uint64_t> totalNanoseconds = 0;
+            std::atomic<uint64_t> maxNanoseconds = 0;
+
+            // Calls of the handler in progress on any thread, Unsubscribe waits for the ones on other threads
+            std::atomic<uint32_t> runningCalls = 0;
+        };
+
+        // Slot map of subscriptions, a deque so that slots never move while a snapshot points to them
+        std::deque<SubscriptionSlot> m_slots;
+        std::vector<uint32_t> m_freeSlots;
+        std::vector<uint32_t> m_unsubscribedSlots;
+        std::map<std::tuple<const void*, EventType, EventCategory>, uint32_t> m_ownedSlots;
+        size_t m_subscriberCount = 0;
+
+        // A list per event type followed by a list per event category bitmask, once for main thread and once for concurrent subscribers.
+        // Category subscribers are listed under every event category bitmask they intersect with, so dispatch only visits handlers that will fire.
+        static constexpr size_t ListsPerSet = EventTypeCount + CategoryMaskCount;
+        static constexpr size_t MainThreadLists = 0;
+        static constexpr size_t ConcurrentLists = ListsPerSet;
+        static constexpr size_t SubscriberListCount = 2 * ListsPerSet;
+
+        // Immutable subscriber lists, stored back to back. Subscribing and unsubscribing publish a new snapshot instead of changing this one.
+        struct SubscriberSnapshot {
+            std::array<uint32_t, SubscriberListCount + 1> offsets{};
+            std::vector<SubscriptionSlot*> slots;
+
+            // Number of slots in the slot map when the snapshot was built, every listed slot has a lower index
+            size_t slotCount = 0;
+
+            std::span<SubscriptionSlot* const> GetList(size_t list) const {
+                return { slots.data() + offsets[list], slots.data() + offsets[list + 1] };
+            }
+
+            bool HasConcurrentSubscribers() const { return offsets[SubscriberListCount] != offsets[ConcurrentLists]; }
+        };
+
+        // A replaced snapshot and the slots unsubscribed with it, freed once no reader that may still see them is reading
+        struct RetiredSnapshot {
+            uint64_t epoch;
+            std::unique_ptr<const SubscriberSnapshot> snapshot;
+            std::vector<uint32_t> slots;
+        };
+
+        std::atomic<const SubscriberSnapshot*> m_snapshot = new SubscriberSnapshot();
+        std::vector<RetiredSnapshot> m_retiredSnapshots;
+        Core::EpochDomain m_epochs;
+
+        // Events of the frame gathered per concurrent subscriber, reused every frame
+        struct ConcurrentBatch {
+            SubscriptionSlot* slot = nullptr;
+
+            // The events with their position in the dispatch order of the frame
+            std::vector<std::pair<Event*, uint32_t>> events;
+
+            // Events already handled, only advanced by the job running the batch
+            std::atomic<uint32_t> handledCount = 0;
+
+            // Whether a job runs the batch or is about to, so that at most one does
+            std::atomic<bool> scheduled = false;
+        };
+
+        // A deque so that the batches, which hold atomics, never move
+        std::deque<ConcurrentBatch> m_concurrentBatches;
+        size_t m_concurrentBatchCount = 0;
+        std::vector<uint32_t> m_slotBatches;
+        std::vector<Event*> m_concurrentEvents;
+        Core::JobCounter m_concurrentJobs;
+
+        // Events of the frame the main-thread handlers have finished with, concurrent handlers only receive those
+        std::atomic<uint32_t> m_mainDispatchedCount = 0;
+
+        std::atomic<bool> m_statsEnabled = false;
+        std::array<EventHistogram, EventTypeCount> m_latencyHistograms;
+        std::array<EventHistogram, EventTypeCount> m_handlerTimeHistograms;
+        EventHistogram m_eventsPerFrameHistogram;
+        std::chrono::milliseconds m_statsDumpInterval{ 0 };
+        std::chrono::steady_clock::time_point m_lastStatsDump;
+
+        // Ticks of the timer wheel are counted from the creation of the EventBus
+        TimerWheel m_timerWheel;
+        std::chrono::steady_clock::time_point m_timerEpoch = std::chrono::steady_clock::now();
+        std::mutex m_timersMutex;
+
+        enum class JournalMode : uint8_t {
+            None,
+            Recording,
+            Replaying
+        };
+
+        // The writer is shared by every publishing thread, the replayed records by PublishNow and ProcessEvents
+        std::atomic<JournalMode> m_journalMode = JournalMode::None;
+        std::mutex m_journalMutex;
+        EventJournalWriter m_journalWriter;
+        EventJournalReader m_journalReader;
+
+        // The frame events published now are dispatched in, advanced when the event buffers are drained
+        std::atomic<uint32_t> m_journalFrame = 0;
 
-        std::vector<EventPtr> m_events;
-        std::vector<Subscription*> m_subscriptions;
+        // The records of the frame being replayed, and the next immediate one a PublishNow call takes
+        std::vector<EventJournalRecord> m_replayRecords;
+        size_t m_replayImmediateIndex = 0;
 
         std::mutex m_subscriptionsMutex;
-        std::mutex m_eventsMutex;
     };
 } // namespace IneptEngine::Events
\ No newline at end of file
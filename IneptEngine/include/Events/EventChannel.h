@@ -0,0 +1,121 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/SharedMemory.h>
+#include <Events/EventQueue.h>
+#include <Events/EventSerialization.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief One event as it is stored in the rings of an EventChannel
+    *
+    * The layout is fixed, the payload is written by WriteEventPayload. The timestamp is the raw engine clock tick count
+    * of the sending process, which counts the same on every process of a machine.
+    */
+    struct EventChannelRecord {
+        uint16_t type;
+        uint16_t payloadSize;
+        uint32_t reserved;
+        uint64_t timestamp;
+        std::byte payload[MaxEventPayloadSize];
+        uint32_t padding;
+    };
+    static_assert(sizeof(EventChannelRecord) == 32, "EventChannelRecord must stay 32 bytes, it is shared between processes");
+    static_assert(std::is_trivially_copyable_v<EventChannelRecord>, "EventChannelRecord is copied between processes");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "The rings of an EventChannel need address-free atomics");
+
+    /**
+    * @brief Identifies the shared memory of an event channel, followed by the layout version
+    */
+    constexpr char EventChannelMagic[4] = { 'I', 'E', 'C', 'H' };
+    constexpr uint32_t EventChannelVersion = 1;
+
+    /**
+    * @class EventChannel
+    * @brief Two-way event connection between two processes through a block of shared memory
+    *
+    * The block holds one lock-free ring per direction, the same EventQueue the EventBus publishes into, so records are
+    * copied in and out without parsing or system calls. One process creates the channel and the other opens it by name.
+    * Sending is safe from any thread of a process, receiving must be done by one thread.
+    *
+    * Nothing blocks: a full ring drops the event, and a process that stops reading only fills its incoming ring.
+    * A process that dies halfway through a send can stall the ring it was writing to, the channel must then be created again.
+    */
+    class EventChannel {
+    public:
+        /**
+         * @brief Number of events each direction holds before sending drops events
+         */
+        static constexpr size_t Capacity = 4096;
+
+        EventChannel() = default;
+
+        EventChannel(const EventChannel&) = delete;
+        EventChannel& operator=(const EventChannel&) = delete;
+
+        /**
+         * @brief Creates the shared memory of a channel, replacing a channel left behind under the same name
+         * @param name The name the other process opens the channel by
+         * @return True if the channel was created
+         */
+        bool Create(const std::string& name);
+
+        /**
+         * @brief Opens a channel created by another process
+         * @param name The name the channel was created with
+         * @return False if the channel does not exist yet or was created by an incompatible build
+         */
+        bool Open(const std::string& name);
+
+        /**
+         * @brief Closes the channel, events still in the rings are lost
+         */
+        void Close();
+
+        /**
+         * @brief Checks if the channel is open
+         */
+        bool IsOpen() const { return m_memory.IsOpen(); }
+
+        /**
+         * @brief Sends an event to the other process, safe to call from any thread
+         * @param event The event to send
+         * @return False if the ring is full and the event was dropped
+         */
+        bool Send(const Event& event);
+
+        /**
+         * @brief Receives the oldest event sent by the other process, must only be called from one thread
+         * @param event Receives the event, with the timestamp it was sent with
+         * @return False if no event is waiting
+         */
+        bool Receive(EventVariant& event);
+
+        /**
+         * @brief The number of events dropped because the ring to the other process was full
+         */
+        size_t GetDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+
+    private:
+        using RecordQueue = EventQueue<EventChannelRecord, Capacity>;
+
+        // The shared memory, written once by the creating process before ready is set
+        struct Layout {
+            char magic[4];
+            uint32_t version;
+            uint32_t recordSize;
+            uint32_t capacity;
+            std::atomic<uint32_t> ready;
+
+            // The creating process sends on the first ring and receives on the second
+            RecordQueue rings[2];
+        };
+
+        Core::SharedMemory m_memory;
+        RecordQueue* m_outgoing = nullptr;
+        RecordQueue* m_incoming = nullptr;
+        std::atomic<size_t> m_droppedCount = 0;
+    };
+} // namespace IneptEngine::Events
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/MappedFile.h>
+#include <Events/EventSerialization.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Header at the start of every event journal file
+    */
+    struct EventJournalHeader {
+        char magic[4];
+        uint32_t version;
+    };
+
+    /**
+    * @brief Identifies event journal files, followed by the format version
+    */
+    constexpr char EventJournalMagic[4] = { 'I', 'E', 'J', 'R' };
+    constexpr uint32_t EventJournalVersion = 2;
+
+    /**
+    * @brief How a recorded event was published, which decides how it is replayed
+    */
+    enum class EventRecordKind : uint8_t {
+        // Published to the event buffer, replayed by publishing it again at the start of its frame's ProcessEvents
+        Queued,
+
+        // Dispatched with PublishNow, replayed in place of the live PublishNow calls of its frame
+        Immediate,
+
+        // Fired by a timer, replayed in place of the live timers of its frame
+        Timer
+    };
+
+    /**
+    * @brief An event read back from a journal
+    */
+    struct EventJournalRecord {
+        EventRecordKind kind;
+        EventVariant event;
+    };
+
+    /**
+    * @class EventJournalWriter
+    * @brief Appends events to a binary journal file through a memory mapping
+    *
+    * Each event is stored as an EventRecordHeader holding the frame number, type and kind, followed by its payload.
+    */
+    class EventJournalWriter {
+    public:
+        /**
+         * @brief Creates the journal file and writes its header
+         * @param path The path of the journal file
+         * @return True if the file was created
+         */
+        bool Open(const std::string& path);
+
+        /**
+         * @brief Appends an event to the journal
+         * @param frame The frame the event is dispatched in
+         * @param kind How the event was published
+         * @param event The event to record
+         * @return False if the file could not be grown
+         */
+        bool Write(uint32_t frame, EventRecordKind kind, const Event& event);
+
+        /**
+         * @brief Closes the journal file
+         */
+        void Close() { m_file.Close(); }
+
+        /**
+         * @brief Checks if a journal file is open
+         */
+        bool IsOpen() const { return m_file.IsOpen(); }
+
+        /**
+         * @brief The number of events written since the journal was opened
+         */
+        size_t GetRecordCount() const { return m_recordCount; }
+
+    private:
+        Core::MappedFile m_file;
+        size_t m_recordCount = 0;
+    };
+
+    /**
+    * @class EventJournalReader
+    * @brief Reads the events of a binary journal file back frame by frame
+    */
+    class EventJournalReader {
+    public:
+        /**
+         * @brief Maps a journal file and checks its header
+         * @param path The path of the journal file
+         * @return True if the file is a journal of a supported version
+         */
+        bool Open(const std::string& path);
+
+        /**
+         * @brief Reads the events recorded up to and including a frame
+         * @param frame The frame to read the events of
+         * @param records Receives the events in the order they were recorded
+         */
+        void ReadFrame(uint32_t frame, std::vector<EventJournalRecord>& records);
+
+        /**
+         * @brief Closes the journal file
+         */
+        void Close() { m_file.Close(); }
+
+        /**
+         * @brief Checks if every event of the journal has been read
+         */
+        bool IsFinished() const { return m_offset >= m_file.GetSize(); }
+
+        /**
+         * @brief Checks if a journal file is open
+         */
+        bool IsOpen() const { return m_file.IsOpen(); }
+
+    private:
+        Core::MappedFile m_file;
+        size_t m_offset = 0;
+    };
+} // namespace IneptEngine::Events
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @class EventQueue
+    * @brief Bounded lock-free multi-producer single-consumer ring buffer
+    *
+    * Any number of threads may push into the queue concurrently without taking a lock, while a single
+    * consumer thread pops from it. Every cell carries a sequence number that tells producers and the consumer
+    * whether the cell is free or holds a value, so neither side ever waits on the other.
+    *
+    * @tparam T The stored value type, must be default constructible and move assignable
+    * @tparam Capacity The number of cells in the ring, must be a power of two
+    */
+    template<typename T, size_t Capacity>
+    class EventQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "EventQueue capacity must be a power of two");
+    public:
+        /**
+         * @brief Constructs an empty queue
+         */
+        EventQueue() {
+            for (size_t i = 0; i < Capacity; i++) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        /**
+         * @brief Pushes a value into the queue, safe to call from any thread
+         *
+         * @param value The value to push, it is only moved from if the push succeeds
+         * @return False if the queue is full
+         */
+        bool TryPush(T&& value) {
+            Cell* cell;
+            size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &m_cells[position & (Capacity - 1)];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0) {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (difference < 0) {
+                    return false;
+                }
+                else {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = std::move(value);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Pops the oldest value from the queue, must only be called from the consumer thread
+         *
+         * @param value Receives the popped value
+         * @return False if the queue is empty
+         */
+        bool TryPop(T& value) {
+            size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+            Cell& cell = m_cells[position & (Capacity - 1)];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1) < 0) {
+                return false;
+            }
+
+            value = std::move(cell.value);
+            cell.sequence.store(position + Capacity, std::memory_order_release);
+            m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Approximate number of values in the queue, exact when no push or pop is in progress
+         */
+        size_t Size() const {
+            size_t enqueued = m_enqueuePosition.load(std::memory_order_relaxed);
+            size_t dequeued = m_dequeuePosition.load(std::memory_order_relaxed);
+            if (enqueued <= dequeued) {
+                return 0;
+            }
+            return enqueued - dequeued < Capacity ? enqueued - dequeued : Capacity;
+        }
+
+        /**
+         * @brief The number of cells in the ring
+         */
+        static constexpr size_t GetCapacity() { return Capacity; }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        std::array<Cell, Capacity> m_cells;
+
+        // Producers and the consumer advance different positions, keep them on separate cache lines
+        alignas(64) std::atomic<size_t> m_enqueuePosition = 0;
+        alignas(64) std::atomic<size_t> m_dequeuePosition = 0;
+    };
+} // namespace IneptEngine::Events
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Events/EventVariant.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Header written in front of every serialized event
+    *
+    * The layout is fixed and little-endian, the payload of payloadSize bytes follows it directly.
+    */
+    struct EventRecordHeader {
+        uint32_t frame;
+        uint16_t type;
+        uint8_t payloadSize;
+
+        // How the event was published, an EventRecordKind
+        uint8_t kind;
+    };
+    static_assert(sizeof(EventRecordHeader) == 8, "EventRecordHeader must stay 8 bytes, it is part of the file format");
+
+    /**
+    * @brief Largest payload any event serializes to, in bytes
+    */
+    constexpr size_t MaxEventPayloadSize = 12;
+
+    /**
+    * @brief Writes the fields of an event to a payload buffer
+    *
+    * @param event The event to serialize
+    * @param payload Receives the fields, must hold at least MaxEventPayloadSize bytes
+    * @return The number of bytes written, 0 for events without fields
+    */
+    size_t WriteEventPayload(const Event& event, std::byte* payload);
+
+    /**
+    * @brief Constructs an event from a payload written by WriteEventPayload
+    *
+    * @param type The type of the serialized event
+    * @param payload The serialized fields
+    * @param payloadSize The number of bytes in the payload
+    * @param event Receives the constructed event
+    * @return False if the type is unknown or the payload has the wrong size
+    */
+    bool ReadEventPayload(EventType type, const std::byte* payload, size_t payloadSize, EventVariant& event);
+} // namespace IneptEngine::Events
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Events/Event.h>
+#include <Events/Subscription.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Summary of the values recorded in an EventHistogram
+    */
+    struct EventHistogramSnapshot {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+        uint64_t p50 = 0;
+        uint64_t p90 = 0;
+        uint64_t p99 = 0;
+
+        /**
+         * @brief The mean of the recorded values, 0 if nothing was recorded
+         */
+        double GetMean() const { return count != 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+    };
+
+    /**
+    * @class EventHistogram
+    * @brief Lock-free histogram with one bucket per power of two
+    *
+    * Any thread may record values concurrently, recording is a handful of relaxed atomic adds. Percentiles are
+    * estimated by interpolating inside the bucket they fall in.
+    */
+    class EventHistogram {
+    public:
+        /**
+         * @brief Number of buckets, bucket i holds the values with a bit width of i
+         */
+        static constexpr size_t BucketCount = 65;
+
+        /**
+         * @brief Records a value, safe to call from any thread
+         * @param value The value to record, e.g a duration in nanoseconds
+         */
+        void Record(uint64_t value) {
+            m_buckets[std::bit_width(value)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t max = m_max.load(std::memory_order_relaxed);
+            while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        /**
+         * @brief Summarizes the recorded values, values recorded meanwhile may or may not be included
+         * @return The count, sum, maximum and percentiles of the recorded values
+         */
+        EventHistogramSnapshot GetSnapshot() const {
+            std::array<uint64_t, BucketCount> buckets;
+            EventHistogramSnapshot snapshot;
+            for (size_t i = 0; i < BucketCount; i++) {
+                buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+                snapshot.count += buckets[i];
+            }
+            snapshot.sum = m_sum.load(std::memory_order_relaxed);
+            snapshot.max = m_max.load(std::memory_order_relaxed);
+            snapshot.p50 = GetPercentile(buckets, snapshot.count, snapshot.max, 0.50);
+            snapshot.p90 = GetPercentile(buckets, snapshot.count, snapshot.max, 0.90);
+            snapshot.p99 = GetPercentile(buckets, snapshot.count, snapshot.max, 0.99);
+            return snapshot;
+        }
+
+        /**
+         * @brief Clears the recorded values
+         */
+        void Reset() {
+            for (auto& bucket : m_buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            m_sum.store(0, std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        static uint64_t GetPercentile(const std::array<uint64_t, BucketCount>& buckets, uint64_t count, uint64_t max, double percentile) {
+            if (count == 0) {
+                return 0;
+            }
+
+            double rank = percentile * static_cast<double>(count);
+            uint64_t below = 0;
+            for (size_t i = 0; i < BucketCount; i++) {
+                if (buckets[i] != 0 && static_cast<double>(below + buckets[i]) >= rank) {
+                    if (i == 0) {
+                        return 0;
+                    }
+                    // Bucket i holds [2^(i-1), 2^i), assume its values are spread evenly
+                    double lower = std::ldexp(1.0, static_cast<int>(i) - 1);
+                    double fraction = (rank - static_cast<double>(below)) / static_cast<double>(buckets[i]);
+                    uint64_t value = static_cast<uint64_t>(lower + lower * fraction);
+                    return (std::min)(value, max);
+                }
+                below += buckets[i];
+            }
+            return max;
+        }
+
+        std::array<std::atomic<uint64_t>, BucketCount> m_buckets{};
+        std::atomic<uint64_t> m_sum = 0;
+        std::atomic<uint64_t> m_max = 0;
+    };
+
+    /**
+    * @brief Timings of one event type
+    */
+    struct EventTypeStats {
+        EventType type;
+
+        /**
+         * @brief Nanoseconds from an event being created to it being dispatched
+         */
+        EventHistogramSnapshot latency;
+
+        /**
+         * @brief Nanoseconds each handler call for the event type took
+         */
+        EventHistogramSnapshot handlerTime;
+    };
+
+    /**
+    * @brief Timings of one subscription
+    */
+    struct EventHandlerStats {
+        SubscriptionHandle handle;
+        std::string name;
+        const void* owner;
+        EventType type;
+        EventCategory category;
+        uint64_t callCount;
+        uint64_t totalNanoseconds;
+        uint64_t maxNanoseconds;
+    };
+} // namespace IneptEngine::Events
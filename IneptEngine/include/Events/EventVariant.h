@@ -0,0 +1,94 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Events/Event.h>
+#include <Events/ApplicationEvent.h>
+#include <Events/WindowEvent.h>
+#include <Events/KeyboardEvent.h>
+#include <Events/MouseEvent.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Closed set of every concrete event, used to store events by value
+    *
+    * The alternatives are listed in the same order as EventType, so the index of an alternative is its EventType minus one.
+    */
+    using EventVariant = std::variant<
+        WindowCloseEvent,
+        WindowResizeEvent,
+        WindowFocusEvent,
+        WindowLostFocusEvent,
+        WindowMovedEvent,
+        WindowMinimizedEvent,
+        WindowRestoredEvent,
+        AppTickEvent,
+        AppUpdateEvent,
+        AppRenderEvent,
+        KeyPressedEvent,
+        KeyReleasedEvent,
+        KeyTypedEvent,
+        KeyHeldEvent,
+        KeyRepeatedEvent,
+        MouseButtonPressedEvent,
+        MouseButtonReleasedEvent,
+        MouseMovedEvent,
+        MouseScrolledEvent>;
+
+
+    /**
+    * @brief Finds the index of an event type in EventVariant at compile time, or the number of alternatives if it is not one
+    */
+    template<typename T, typename Variant = EventVariant>
+    struct EventVariantIndex;
+
+    template<typename T, typename... Alternatives>
+    struct EventVariantIndex<T, std::variant<Alternatives...>> {
+        static constexpr size_t value = []() {
+            constexpr bool matches[] = { std::is_same_v<T, Alternatives>... };
+            size_t index = 0;
+            while (index < sizeof...(Alternatives) && !matches[index]) {
+                index++;
+            }
+            return index;
+        }();
+    };
+
+    /**
+    * @brief Checks at compile time if an event type is one of the EventVariant alternatives
+    */
+    template<typename T>
+    inline constexpr bool IsEventVariantAlternativeV = EventVariantIndex<T>::value < std::variant_size_v<EventVariant>;
+
+    /**
+    * @brief The EventType of a concrete event class, resolved at compile time from the type it declares
+    */
+    template<typename T>
+    inline constexpr EventType EventTypeOf = T::StaticType;
+
+    /**
+    * @brief Checks at compile time that every alternative of EventVariant sits at the index of its EventType
+    *
+    * EventType minus one is used as the variant index when events are stored by value or read from a journal.
+    */
+    template<size_t... Indices>
+    constexpr bool IsEventVariantInEventTypeOrder(std::index_sequence<Indices...>) {
+        return ((EventTypeOf<std::variant_alternative_t<Indices, EventVariant>> == static_cast<EventType>(Indices + 1)) && ...);
+    }
+
+    static_assert(std::variant_size_v<EventVariant> == static_cast<size_t>(EventType::MouseScrolled),
+        "EventVariant must hold one alternative per EventType");
+    static_assert(IsEventVariantInEventTypeOrder(std::make_index_sequence<std::variant_size_v<EventVariant>>()),
+        "EventVariant alternatives must be listed in the same order as EventType");
+
+    /**
+    * @fn Event* GetEvent(EventVariant& event)
+    * @brief Gets the Event view of an event stored by value
+    * @param event The stored event
+    * @return A pointer to the stored event as its Event base
+    */
+    inline Event* GetEvent(EventVariant& event) {
+        return std::visit([](auto& concreteEvent) -> Event* { return &concreteEvent; }, event);
+    }
+} // namespace IneptEngine::Events
@@ -53,12 +53,17 @@ namespace IneptEngine::Events {
 	 */
 	class KeyPressedEvent : public KeyEvent {
 	public:
+		/**
+		 * @brief The EventType every KeyPressedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::KeyPressed;
+
 		/**
 		 * @brief Constructs a new KeyPressedEvent
 		 * @param key The key that was pressed
 		 * @param mods The keyboard modifiers that were active when the event occurred
 		 */
-		KeyPressedEvent(Keyboard::Key  key, Keyboard::KeyModifier mods) : KeyEvent(EventType::KeyPressed, key, mods) {}
+		KeyPressedEvent(Keyboard::Key  key, Keyboard::KeyModifier mods) : KeyEvent(StaticType, key, mods) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -78,12 +83,17 @@ namespace IneptEngine::Events {
 	 */
 	class KeyReleasedEvent : public KeyEvent {
 	public:
+		/**
+		 * @brief The EventType every KeyReleasedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::KeyReleased;
+
 		/**
 		 * @brief Constructs a new KeyReleasedEvent
 		 * @param key The key that was released
 		 * @param mods The keyboard modifiers that were active when the event occurred
 		 */
-		KeyReleasedEvent(Keyboard::Key  key, Keyboard::KeyModifier mods) : KeyEvent(EventType::KeyReleased, key, mods) {}
+		KeyReleasedEvent(Keyboard::Key  key, Keyboard::KeyModifier mods) : KeyEvent(StaticType, key, mods) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -103,12 +113,17 @@ namespace IneptEngine::Events {
 	 */
 	class KeyTypedEvent : public KeyEvent {
 	public:
+		/**
+		 * @brief The EventType every KeyTypedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::KeyTyped;
+
 		/**
 		 * @brief Constructs a new KeyTypedEvent
 		 * @param key The key that was typed
 		 * @param mods The keyboard modifiers that were active when the event occurred
 		 */
-		KeyTypedEvent(Keyboard::Key key, Keyboard::KeyModifier mods) : KeyEvent(EventType::KeyTyped, key, mods) {}
+		KeyTypedEvent(Keyboard::Key key, Keyboard::KeyModifier mods) : KeyEvent(StaticType, key, mods) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -128,13 +143,18 @@ namespace IneptEngine::Events {
 	 */
 	class KeyHeldEvent : public KeyEvent {
 	public:
+		/**
+		 * @brief The EventType every KeyHeldEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::KeyHeld;
+
 		/**
 		 * @brief Constructs a new KeyHeldEvent
 		 * @param key The key that was held
 		 * @param mods The keyboard modifiers that were active when the event occurred
 		 * @param duration The duration that the key was held, in seconds
 		 */
-		KeyHeldEvent(Keyboard::Key key, Keyboard::KeyModifier mods, float duration) : KeyEvent(EventType::KeyHeld, key, mods), m_duration(duration) {}
+		KeyHeldEvent(Keyboard::Key key, Keyboard::KeyModifier mods, float duration) : KeyEvent(StaticType, key, mods), m_duration(duration) {}
 
 		/**
 		 * @brief Gets the duration that the key was held, in seconds
@@ -162,13 +182,18 @@ namespace IneptEngine::Events {
 	 */
 	class KeyRepeatedEvent : public KeyEvent {
 	public:
+		/**
+		 * @brief The EventType every KeyRepeatedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::KeyRepeated;
+
 		/**
 		 * @brief Constructs a new KeyRepeatedEvent
 		 * @param key The key that was repeated
 		 * @param mods The keyboard modifiers that were active when the event occurred
 		 * @param repeatCount The number of times the key has been repeated
 		 */
-		KeyRepeatedEvent(Keyboard::Key key, Keyboard::KeyModifier mods, int repeatCount) : KeyEvent(EventType::KeyRepeated, key, mods), m_repeatCount(repeatCount) {}
+		KeyRepeatedEvent(Keyboard::Key key, Keyboard::KeyModifier mods, int repeatCount) : KeyEvent(StaticType, key, mods), m_repeatCount(repeatCount) {}
 
 		/**
 		 * @brief Gets the number of times the key has been repeated
@@ -51,13 +51,18 @@ namespace IneptEngine::Events {
 	 */
 	class MouseButtonPressedEvent : public MouseEvent {
 	public:
+		/**
+		 * @brief The EventType every MouseButtonPressedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::MouseButtonPressed;
+
 		/**
 		 * @brief Constructs a new MouseButtonPressedEvent
 		 * @param button The mouse button that was pressed
 		 * @param x The x coordinate of the mouse cursor, in pixels
 		 * @param y The y coordinate of the mouse cursor, in pixels
 		 */
-		MouseButtonPressedEvent(IneptEngine::Input::MouseButton button, float x, float y) : MouseEvent(EventType::MouseButtonPressed, x, y, EventCategory::MouseButton), m_button(button) {}
+		MouseButtonPressedEvent(IneptEngine::Input::MouseButton button, float x, float y) : MouseEvent(StaticType, x, y, EventCategory::MouseButton), m_button(button) {}
 
 		/**
 		 * @brief Gets the mouse button that was pressed
@@ -84,13 +89,18 @@ namespace IneptEngine::Events {
 	 */
 	class MouseButtonReleasedEvent : public MouseEvent {
 	public:
+		/**
+		 * @brief The EventType every MouseButtonReleasedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::MouseButtonReleased;
+
 		/**
 		 * @brief Constructs a new MouseButtonReleasedEvent
 		 * @param button The mouse button that was released
 		 * @param x The x coordinate of the mouse cursor, in pixels
 		 * @param y The y coordinate of the mouse cursor, in pixels
 		 */
-		MouseButtonReleasedEvent(IneptEngine::Input::MouseButton button, float x, float y) : MouseEvent(EventType::MouseButtonReleased, x, y, EventCategory::MouseButton), m_button(button) {}
+		MouseButtonReleasedEvent(IneptEngine::Input::MouseButton button, float x, float y) : MouseEvent(StaticType, x, y, EventCategory::MouseButton), m_button(button) {}
 
 		/**
 		 * @brief Gets the mouse button that was released
@@ -118,12 +128,17 @@ namespace IneptEngine::Events {
 	 */
 	class MouseMovedEvent : public MouseEvent {
 	public:
+		/**
+		 * @brief The EventType every MouseMovedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::MouseMoved;
+
 		/**
 		 * @brief Constructs a new MouseMovedEvent
 		 * @param x The x coordinate of the mouse cursor, in pixels
 		 * @param y The y coordinate of the mouse cursor, in pixels
 		 */
-		MouseMovedEvent(float x, float y) : MouseEvent(EventType::MouseMoved, x, y, EventCategory::Mouse) {}
+		MouseMovedEvent(float x, float y) : MouseEvent(StaticType, x, y, EventCategory::Mouse) {}
 
 		/**
 		 * @brief Returns a string representation of the event.
@@ -142,12 +157,17 @@ namespace IneptEngine::Events {
 	 */
 	class MouseScrolledEvent : public MouseEvent {
 	public:
+		/**
+		 * @brief The EventType every MouseScrolledEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::MouseScrolled;
+
 		/**
 		 * @brief Constructs a new MouseScrolledEvent
 		 * @param xOffset The x offset of the scroll wheel, in pixels
 		 * @param yOffset The y offset of the scroll wheel, in pixels
 		 */
-		MouseScrolledEvent(float xOffset, float yOffset) : MouseEvent(EventType::MouseScrolled, xOffset, yOffset, EventCategory::Mouse) {}
+		MouseScrolledEvent(float xOffset, float yOffset) : MouseEvent(StaticType, xOffset, yOffset, EventCategory::Mouse) {}
 
 		/**
 		 * @brief Gets the x offset of the scroll wheel, in pixels
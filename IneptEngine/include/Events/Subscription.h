@@ -0,0 +1,96 @@
+#pragma once
+
+#include <iepch.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Identifies a subscription slot in the EventBus
+    *
+    * The generation changes every time a slot is freed, so a handle to an unsubscribed handler never matches a newer subscription.
+    */
+    struct SubscriptionHandle {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool operator==(const SubscriptionHandle& other) const = default;
+    };
+
+    /**
+    * @class SubscriptionToken
+    * @brief Owns a subscription and unsubscribes it when destroyed
+    *
+    * Tokens are returned by every EventBus::Subscribe overload. Keep the token alive for as long as the handler
+    * should receive events, e.g as a member of the object whose handler is subscribed.
+    */
+    class [[nodiscard]] SubscriptionToken {
+    public:
+        /**
+         * @brief Constructs an empty token that owns no subscription
+         */
+        SubscriptionToken() = default;
+
+        /**
+         * @brief Constructs a token owning the given subscription
+         * @param handle The subscription to own
+         */
+        explicit SubscriptionToken(SubscriptionHandle handle) : m_handle(handle) {}
+
+        SubscriptionToken(const SubscriptionToken&) = delete;
+        SubscriptionToken& operator=(const SubscriptionToken&) = delete;
+
+        /**
+         * @brief Takes over the subscription of another token
+         */
+        SubscriptionToken(SubscriptionToken&& other) noexcept : m_handle(other.m_handle) {
+            other.m_handle = SubscriptionHandle();
+        }
+
+        /**
+         * @brief Unsubscribes the current subscription and takes over the subscription of another token
+         */
+        SubscriptionToken& operator=(SubscriptionToken&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                m_handle = other.m_handle;
+                other.m_handle = SubscriptionHandle();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Unsubscribes the owned subscription
+         */
+        ~SubscriptionToken() {
+            Reset();
+        }
+
+        /**
+         * @brief Unsubscribes the owned subscription, leaving the token empty
+         */
+        void Reset();
+
+        /**
+         * @brief Gives up ownership, the subscription then stays alive until unsubscribed through its handle
+         * @return The handle of the subscription
+         */
+        SubscriptionHandle Release() {
+            SubscriptionHandle handle = m_handle;
+            m_handle = SubscriptionHandle();
+            return handle;
+        }
+
+        /**
+         * @brief Checks if the token owns a subscription
+         */
+        bool IsValid() const { return m_handle.index != UINT32_MAX; }
+
+        /**
+         * @brief Gets the handle of the owned subscription
+         */
+        SubscriptionHandle GetHandle() const { return m_handle; }
+
+    private:
+        SubscriptionHandle m_handle;
+    };
+} // namespace IneptEngine::Events
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Events/EventVariant.h>
+
+namespace IneptEngine::Events
+{
+    /**
+    * @brief Identifies a timer scheduled in a TimerWheel
+    *
+    * The generation changes every time a timer fires for the last time or is cancelled, so a stale handle never matches a newer timer.
+    */
+    struct TimerHandle {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool operator==(const TimerHandle& other) const = default;
+    };
+
+    /**
+    * @class TimerWheel
+    * @brief Hierarchical timer wheel holding events to publish once a tick is reached
+    *
+    * Timers are kept in intrusive lists, one per slot of four wheels of 256 slots each. The first wheel has a slot per tick,
+    * every further wheel covers 256 times the range of the previous one, so scheduling and cancelling a timer is constant time.
+    * Advancing only visits the slot of every passed tick, and the timers of a higher wheel are moved down into the lower wheels
+    * when the lower wheel wraps, so the cost never depends on the number of pending timers.
+    *
+    * The wheel is not thread-safe, the EventBus guards it with a lock.
+    */
+    class TimerWheel {
+    public:
+        /**
+         * @brief Number of bits of the tick each wheel is indexed by
+         */
+        static constexpr uint32_t SlotBits = 8;
+
+        /**
+         * @brief Number of slots in every wheel
+         */
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+
+        /**
+         * @brief Number of wheels, together they cover 2^32 ticks
+         */
+        static constexpr uint32_t LevelCount = 4;
+
+        /**
+         * @brief Constructs an empty wheel at tick zero
+         */
+        TimerWheel() {
+            m_heads.fill(InvalidIndex);
+            m_tails.fill(InvalidIndex);
+        }
+
+        /**
+         * @brief Schedules an event to be fired at a tick
+         *
+         * Timers due at a tick that has already passed fire on the next Advance. Timers further away than the range of the wheels
+         * are kept in the last wheel until they come into range.
+         *
+         * @param dueTick The tick to fire the event at
+         * @param period The number of ticks between two firings, zero to fire only once
+         * @param event The event to fire, copied every time a periodic timer fires
+         * @return The handle of the timer
+         */
+        TimerHandle Schedule(uint64_t dueTick, uint64_t period, EventVariant event);
+
+        /**
+         * @brief Cancels a pending timer
+         * @param handle The handle of the timer
+         * @return True if the timer was pending and will not fire anymore
+         */
+        bool Cancel(TimerHandle handle);
+
+        /**
+         * @brief Checks if a timer is still pending
+         * @param handle The handle of the timer
+         */
+        bool IsPending(TimerHandle handle) const {
+            return handle.index < m_timers.size() && m_timers[handle.index].pending && m_timers[handle.index].generation == handle.generation;
+        }
+
+        /**
+         * @brief Fires every timer due up to and including a tick
+         *
+         * Events are appended in the order of their due tick, timers due at the same tick in the order they were scheduled.
+         * A periodic timer fires once for every period that passed, so it catches up after a long frame.
+         *
+         * @param tick The tick to advance to
+         * @param firedEvents Receives the events of the fired timers
+         */
+        void Advance(uint64_t tick, std::vector<EventVariant>& firedEvents);
+
+        /**
+         * @brief The next tick that has not been advanced past yet
+         */
+        uint64_t GetCurrentTick() const { return m_currentTick; }
+
+        /**
+         * @brief The number of timers that have not fired for the last time yet
+         */
+        size_t GetPendingCount() const { return m_pendingCount; }
+
+    private:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+        static constexpr uint64_t SlotMask = SlotCount - 1;
+
+        // Ticks covered by all wheels together, timers further away are parked in the last slot in range
+        static constexpr uint64_t MaxDelta = uint64_t(1) << (SlotBits * LevelCount);
+
+        struct Timer {
+            uint64_t dueTick = 0;
+            uint64_t period = 0;
+            uint32_t generation = 0;
+            uint32_t list = InvalidIndex;
+            uint32_t previous = InvalidIndex;
+            uint32_t next = InvalidIndex;
+            bool pending = false;
+            EventVariant event;
+        };
+
+        /**
+         * @brief Appends a timer to the list of the slot its due tick falls in, relative to the current tick
+         * @param index The index of the timer
+         */
+        void Link(uint32_t index);
+
+        /**
+         * @brief Removes a timer from the list it is in
+         * @param index The index of the timer
+         */
+        void Unlink(uint32_t index);
+
+        /**
+         * @brief Detaches the list of a slot
+         * @param list The index of the slot list
+         * @return The first timer of the detached list
+         */
+        uint32_t TakeList(uint32_t list);
+
+        /**
+         * @brief Moves every timer of a slot in a higher wheel down into the wheels below
+         * @param level The wheel
+         * @param slot The slot of the wheel
+         */
+        void Cascade(uint32_t level, uint32_t slot);
+
+        /**
+         * @brief Marks a timer as no longer pending and makes it available for reuse
+         * @param index The index of the timer
+         */
+        void Free(uint32_t index);
+
+        std::vector<Timer> m_timers;
+        std::vector<uint32_t> m_freeTimers;
+
+        // One list per slot of every wheel, the slots of wheel n start at n * SlotCount
+        std::array<uint32_t, LevelCount * SlotCount> m_heads;
+        std::array<uint32_t, LevelCount * SlotCount> m_tails;
+
+        uint64_t m_currentTick = 0;
+        size_t m_pendingCount = 0;
+    };
+} // namespace IneptEngine::Events
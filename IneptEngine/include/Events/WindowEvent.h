@@ -34,11 +34,16 @@ namespace IneptEngine::Events {
 	*/
 	class WindowCloseEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowCloseEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowClose;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 */
-		WindowCloseEvent() : WindowEvent(EventType::WindowClose) {}
+		WindowCloseEvent() : WindowEvent(StaticType) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -60,13 +65,18 @@ namespace IneptEngine::Events {
 	*/
 	class WindowResizeEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowResizeEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowResize;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 * @param width The new width of the window
 		 * @param height The new height of the window
 		 */
-		WindowResizeEvent(int width, int height) : WindowEvent(EventType::WindowResize), m_width(width), m_height(height) {}
+		WindowResizeEvent(int width, int height) : WindowEvent(StaticType), m_width(width), m_height(height) {}
 
 		/**
 		 * @fn int GetWidth() const
@@ -106,11 +116,16 @@ namespace IneptEngine::Events {
 	*/
 	class WindowFocusEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowFocusEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowFocus;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 */
-		WindowFocusEvent() : WindowEvent(EventType::WindowFocus) {}
+		WindowFocusEvent() : WindowEvent(StaticType) {}
 
 		/**
 		* @fn std::string ToString() const
@@ -132,11 +147,16 @@ namespace IneptEngine::Events {
 	*/
 	class WindowLostFocusEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowLostFocusEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowLostFocus;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 */
-		WindowLostFocusEvent() : WindowEvent(EventType::WindowLostFocus) {}
+		WindowLostFocusEvent() : WindowEvent(StaticType) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -158,13 +178,18 @@ namespace IneptEngine::Events {
 	*/
 	class WindowMovedEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowMovedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowMoved;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 * @param x The new x position of the window
 		 * @param y The new y position of the window
 		 */
-		WindowMovedEvent(int x, int y) : WindowEvent(EventType::WindowMoved), m_x(x), m_y(y) {}
+		WindowMovedEvent(int x, int y) : WindowEvent(StaticType), m_x(x), m_y(y) {}
 
 		/**
 		 * @fn int GetX() const
@@ -204,11 +229,16 @@ namespace IneptEngine::Events {
 	*/
 	class WindowMinimizedEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowMinimizedEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowMinimized;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 */
-		WindowMinimizedEvent() : WindowEvent(EventType::WindowMinimized) {}
+		WindowMinimizedEvent() : WindowEvent(StaticType) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -230,11 +260,16 @@ namespace IneptEngine::Events {
 	*/
 	class WindowRestoredEvent : public WindowEvent {
 	public:
+		/**
+		 * @brief The EventType every WindowRestoredEvent is created with
+		 */
+		static constexpr EventType StaticType = EventType::WindowRestored;
+
 		/**
 		 * @brief Constructor
 		 * @param window The window that this event is for
 		 */
-		WindowRestoredEvent() : WindowEvent(EventType::WindowRestored) {}
+		WindowRestoredEvent() : WindowEvent(StaticType) {}
 
 		/**
 		 * @fn std::string ToString() const
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <Events/EventBus.h>
+#include <Events/EventBridge.h>
+
+#include <Core/JobSystem.h>
+#include <Core/Profiler.h>
+#include <Core/MemoryTracker.h>
 
 #include <Logging/Log.h>
 using namespace IneptEngine::Logging;
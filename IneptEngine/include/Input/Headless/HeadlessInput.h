@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Input/Input.h>
+
+namespace IneptEngine::Input {
+	/**
+	 * @class HeadlessInput
+	 * @brief Input of a headless window, no key or button is ever pressed and callbacks are never called
+	 *
+	 * Input in a headless application comes from events published on the EventBus, e.g a replayed journal.
+	 */
+	class HeadlessInput : public InputManager
+	{
+	public:
+		HeadlessInput() = default;
+		virtual ~HeadlessInput() = default;
+		virtual bool IsKeyPressed(Keyboard::Key) override { return false; }
+		virtual bool IsMouseButtonPressed(int) override { return false; }
+		virtual std::pair<int, int> GetMousePosition() override { return { 0, 0 }; }
+		virtual std::map<Keyboard::Key, bool> GetKeyStates() override { return {}; }
+		virtual std::map<int, bool> GetMouseButtonStates() override { return {}; }
+		virtual void RegisterKeyCallback(Keyboard::Key, std::function<void(int)>) override {}
+		virtual void RegisterAllKeyCallback(std::function<void(Keyboard::Key)>) override {}
+		virtual void RegisterMouseButtonCallback(int, std::function<void(int)>) override {}
+		virtual void RegisterMouseMoveCallback(std::function<void(int, int)>) override {}
+		virtual void PollEvents() override {}
+	};
+}
@@ -78,5 +78,11 @@ namespace IneptEngine::Input
          * @brief Checks for any events in the buffer.
          */
         virtual void PollEvents() = 0;
+
+        /*
+         * @brief Blocks until the operating system has an event for the window, or the timeout has passed.
+         * @param timeout The longest time to wait.
+         */
+        virtual void WaitForEvents(std::chrono::milliseconds timeout) { std::this_thread::sleep_for(timeout); }
     };
 } //namespace IneptEngine::Input
\ No newline at end of file
@@ -5,7 +5,9 @@
 #include <vector>
 #include <unordered_map>
 
+#ifdef INEPT_PLATFORM_WINDOWS
 #include <Windows.h>
+#endif
 
 
 
@@ -229,6 +231,8 @@ namespace IneptEngine::Input {
 			return "Invalid key";
 		};
 
+		// Platform key codes, there are none on platforms without a window
+#ifdef INEPT_PLATFORM_WINDOWS
 		std::unordered_map<int, Key> keyMap = {
 			{VK_ESCAPE , Key::KEY_ESCAPE },
 		};
@@ -242,6 +246,10 @@ namespace IneptEngine::Input {
 			{VK_RMENU, KeyModifier::Right_Alt},
 			{VK_RWIN, KeyModifier::Right_Super},
 		};
+#else
+		std::unordered_map<int, Key> keyMap;
+		std::unordered_map<int, KeyModifier> keyModifierMap;
+#endif
 
 	private:
 		std::vector<bool> m_keyState;
@@ -21,12 +21,14 @@ namespace IneptEngine::Input {
 		virtual void RegisterMouseButtonCallback(int button, std::function<void(int)> callback) override;
 		virtual void RegisterMouseMoveCallback(std::function<void(int, int)> callback) override;
 		virtual void PollEvents() override;
+		virtual void WaitForEvents(std::chrono::milliseconds timeout) override;
 		static LRESULT CALLBACK WndProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 	private:
 		void HandleWindowsMessage(WindowsWindow* window, UINT message, WPARAM wParam, LPARAM lParam);
 		void SetWindow(WindowsWindow* window);
 
 		WindowsWindow* m_Window;
+		bool m_minimized = false;
 
 		std::vector<std::function<void(Keyboard::Key)>> m_allKeyCallbacks;
 		std::map<int, std::vector<std::function<void(int)>>> m_keyCallbacks;
@@ -4,30 +4,32 @@
 
 #include "LogEnums.h"
 
+#include <Core/FrameAllocator.h>
+
 #define LOG_INFO(...) \
     IneptEngine::Logging::Log::logMessage( \
         IneptEngine::Logging::LogLevel::LOGINFO, \
-        std::format(__VA_ARGS__)\
+        IneptEngine::Logging::Log::Format(__VA_ARGS__)\
 		)
 #define LOG_TRACE(...) \
     IneptEngine::Logging::Log::logMessage( \
         IneptEngine::Logging::LogLevel::LOGTRACE, \
-        std::format(__VA_ARGS__)\
+        IneptEngine::Logging::Log::Format(__VA_ARGS__)\
 		)
 #define LOG_DEBUG(...) \
     IneptEngine::Logging::Log::logMessage( \
         IneptEngine::Logging::LogLevel::LOGDEBUG, \
-        std::format(__VA_ARGS__)\
+        IneptEngine::Logging::Log::Format(__VA_ARGS__)\
 		)
 #define LOG_WARNING(...) \
     IneptEngine::Logging::Log::logMessage( \
         IneptEngine::Logging::LogLevel::LOGWARNING, \
-        std::format(__VA_ARGS__)\
+        IneptEngine::Logging::Log::Format(__VA_ARGS__)\
 		)
 #define LOG_ERROR(...) \
     IneptEngine::Logging::Log::logMessage( \
         IneptEngine::Logging::LogLevel::LOGERROR, \
-        std::format(__VA_ARGS__),\
+        IneptEngine::Logging::Log::Format(__VA_ARGS__),\
 		true)//;\
 		//DebugBreak()
 
@@ -44,13 +46,30 @@ namespace IneptEngine::Logging
 		 */
 		static void Init(std::ostream &output = std::cout);
 		/**
-		 * @fn static void logMessage(LogLevel level, const std::string& message, bool isVerbose = false, std::string func = __builtin_FUNCTION(), std::string file = __builtin_FILE(), int line = __builtin_LINE());
+		 * @fn static void logMessage(LogLevel level, std::string_view message, bool isVerbose = false, const char* func = __builtin_FUNCTION(), const char* file = __builtin_FILE(), int line = __builtin_LINE());
 		 * @brief Logs a message with the appropriate color based on the logging level.
 		 *
 		 * @param level The logging level for the message.
 		 * @param message The message to log.
 		 */
-		static void logMessage(LogLevel level, const std::string& message, bool isVerbose = false, std::string func = __builtin_FUNCTION(), std::string file = __builtin_FILE(), int line = __builtin_LINE());
+		static void logMessage(LogLevel level, std::string_view message, bool isVerbose = false, const char* func = __builtin_FUNCTION(), const char* file = __builtin_FILE(), int line = __builtin_LINE());
+
+		/**
+		 * @brief Formats a message for the LOG_ macros
+		 *
+		 * Once the Application runs frames the message is formatted into frame memory, so logging every frame does not
+		 * allocate from the heap. Messages logged before the first frame, or by programs without frames, use the heap.
+		 *
+		 * @param format The std::format format string
+		 * @param args The values to format
+		 * @return The message, valid until the end of the next frame
+		 */
+		template<typename... Args>
+		static Core::FrameString Format(std::format_string<Args...> format, Args&&... args) {
+			Core::FrameString message(Core::FrameAllocator::GetFrameIndex() != 0 ? Core::FrameAllocator::GetMemoryResource() : std::pmr::get_default_resource());
+			std::format_to(std::back_inserter(message), format, std::forward<Args>(args)...);
+			return message;
+		}
 		/**
 		 * @brief Logs a message with the specified logging level and color.
 		 *
@@ -10,10 +10,17 @@ namespace IneptEngine::Rendering
 	{
 	public:
 		Context(Windowing::Window* window) : m_window(window) {}
+		virtual ~Context() = default;
+
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
 		virtual void MakeCurrent() = 0;
 
+		/**
+		 * @brief Detaches the context from the calling thread, so another thread can make it current
+		 */
+		virtual void ReleaseCurrent() = 0;
+
 	private:
 		Windowing::Window* m_window;
 	};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Rendering/Renderer.h>
+
+namespace IneptEngine::Rendering {
+    /**
+     * @class NullRenderer
+     * @brief A renderer without a rendering context that draws nothing, used by headless applications
+     *
+     * Frames are still recorded and handed over like with any other renderer, including to a render thread when
+     * pipelined, but their commands are dropped instead of run since they expect a context to draw into.
+     */
+    class NullRenderer : public Renderer
+    {
+    public:
+        NullRenderer(IneptEngine::Windowing::Window* window) : Renderer(window) {}
+
+        virtual ~NullRenderer() {
+            SetPipelined(false);
+        }
+
+    protected:
+        virtual void DrawFrame(RenderFrame&) override {}
+    };
+}
@@ -6,9 +6,6 @@
 
 #ifdef INEPT_PLATFORM_WINDOWS
 #include <Windowing/Windows/WindowsWindow.h>
-#elif INEPT_PLATFORM_LINUX
-#include <X11/Xlib.h>
-#include <GL/glx.h>
 #elif INEPT_PLATFORM_MACOS
 #include <OpenGL/OpenGL.h>
 #endif
@@ -18,20 +15,23 @@ namespace IneptEngine::Rendering
 	{
 	public:
 		OpenGLContext(IneptEngine::Windowing::Window* window);
+		virtual ~OpenGLContext();
 
 		virtual void Init() override;
 		virtual void SwapBuffers() override;
 		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
         // Platform-specific window handle and device context/display
     private:
 #ifdef INEPT_PLATFORM_WINDOWS
-        IneptEngine::Windowing::WindowsWindow* m_Window;
+        // The handle is kept rather than the window, the context outlives the WindowsWindow part of it
+        HWND m_WindowHandle;
         void* m_DeviceContext;
         void* m_OpenGLContext;
 #elif INEPT_PLATFORM_LINUX
-        void* m_Display;
-        void* m_Window;
-        void* m_OpenGLContext;
+        void* m_Display = nullptr;
+        void* m_Window = nullptr;
+        void* m_OpenGLContext = nullptr;
 #elif INEPT_PLATFORM_MACOS
         void* m_Window;
 #endif
@@ -3,7 +3,8 @@
 #include <iepch.h>
 
 #include <Rendering/Primitives/Polygon.h>
-#include <Rendering/OpenGl/OpenGLShader.h>
+#include <Rendering/OpenGL/OpenGLShader.h>
+#include <Core/MemoryTracker.h>
 
 #include <glad/glad.h>
 
@@ -11,12 +12,23 @@ namespace IneptEngine::Rendering {
     class OpenGLPolygon : public Polygon {
     public:
         OpenGLPolygon(std::vector<float> vertices, std::vector<unsigned int> indices) : Polygon(vertices, indices) {
-            m_shader = new OpenGLShader();
+            m_shader = INEPT_NEW(Rendering) OpenGLShader();
             if (m_shader->LoadShader("shaders\\OpenGL\\vert.shader", "shaders\\OpenGL\\frag.shader")) {
                 LOG_DEBUG("Shaders compiled and linked");
             }
         }
-        virtual ~OpenGLPolygon() {}
+        OpenGLPolygon(const OpenGLPolygon&) = delete;
+        OpenGLPolygon& operator=(const OpenGLPolygon&) = delete;
+
+        /**
+         * @brief Deletes the buffers and the shader, the context has to be current on the calling thread
+         */
+        virtual ~OpenGLPolygon() {
+            glDeleteBuffers(1, &m_IndexBuffer);
+            glDeleteBuffers(1, &m_VertexBuffer);
+            glDeleteVertexArrays(1, &m_VertexArray);
+            delete m_shader;
+        }
 
         virtual OpenGLShader* GetShader() { return m_shader; }
 
@@ -24,7 +36,7 @@ namespace IneptEngine::Rendering {
         virtual void Unbind() override;
         virtual void Render() override;
     private:
-        GLuint m_VertexArray, m_VertexBuffer, m_IndexBuffer;
+        GLuint m_VertexArray = 0, m_VertexBuffer = 0, m_IndexBuffer = 0;
 
         OpenGLShader* m_shader; // Move to renderable as shader(base)
     };
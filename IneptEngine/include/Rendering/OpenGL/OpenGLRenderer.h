@@ -1,7 +1,7 @@
 #pragma once
 
 #include <Rendering/Renderer.h>
-#include <Rendering/OpenGl/OpenGLContext.h>
+#include <Rendering/OpenGL/OpenGLContext.h>
 
 #include <Rendering/Primitives/Square.h>
 #include "OpenGLCamera.h"
@@ -11,7 +11,7 @@ namespace IneptEngine::Rendering {
     {
     public:
         OpenGLRenderer(IneptEngine::Windowing::Window* window) : Renderer(window) {
-            m_context = new OpenGLContext(window);
+            m_context = INEPT_NEW(Rendering) OpenGLContext(window);
             m_context->Init();
 
 			//OpenGL+GPU Info
@@ -24,16 +24,16 @@ namespace IneptEngine::Rendering {
 			LOG_TRACE("OpenGL Info:\n        GPU: {0} {1}\n        {2}", Vendor, Renderer, Version);
 
 			//
-			square = new Square({ 0,0 }, 1.0f);
+			square = INEPT_NEW(Rendering) Square({ 0,0 }, 1.0f);
 			square->Bind();
 			//
 
-			EVENT_SUBSCRIBE(KeyPressed,[this](Events::Event* e) {
+			m_keyPressedSubscription = EVENT_SUBSCRIBE_TYPED(KeyPressedEvent, [this](Events::KeyPressedEvent& e) {
 				//LOG_DEBUG("key pressed");
 				OnKeyPressed(e);
 			});
 
-			EVENT_SUBSCRIBE(WindowResize, [this](Events::Event* e) {
+			m_windowResizeSubscription = EVENT_SUBSCRIBE_TYPED(WindowResizeEvent, [this](Events::WindowResizeEvent& e) {
 				OnWindowResize(e);
 			});
 			camera = OpenGLCamera();
@@ -56,66 +56,77 @@ namespace IneptEngine::Rendering {
 
         }
 
-		void OnWindowResize(Events::Event* e) {
-			Events::WindowResizeEvent* resizeEvent = static_cast<Events::WindowResizeEvent*>(e);
-			if (resizeEvent->GetWidth() != 0 && resizeEvent->GetHeight() != 0) {
+		void OnWindowResize(Events::WindowResizeEvent& resizeEvent) {
+			if (resizeEvent.GetWidth() != 0 && resizeEvent.GetHeight() != 0) {
 
-				glViewport(0, 0, resizeEvent->GetWidth(), resizeEvent->GetHeight());
-				camera.SetAspectRatio(static_cast<float>(resizeEvent->GetWidth()) / static_cast<float>(resizeEvent->GetHeight()));
+				// The viewport is set when the next frame is drawn, on the thread that owns the context
+				m_viewportWidth = resizeEvent.GetWidth();
+				m_viewportHeight = resizeEvent.GetHeight();
+				camera.SetAspectRatio(static_cast<float>(resizeEvent.GetWidth()) / static_cast<float>(resizeEvent.GetHeight()));
 				//LOG_DEBUG("Aspect Ratio: {}", static_cast<float>(resizeEvent->GetWidth()) / static_cast<float>(resizeEvent->GetHeight()));
 				//LOG_DEBUG("Width,Height: {},{}",resizeEvent->GetWidth() , resizeEvent->GetHeight());
 			}
 		}
 
-		void OnKeyPressed(Events::Event* e) {
-			Events::KeyPressedEvent* keyevent = static_cast<Events::KeyPressedEvent*>(e);
-				if (keyevent->GetKey() == Keyboard::Key::KEY_W)
+		void OnKeyPressed(Events::KeyPressedEvent& keyevent) {
+				if (keyevent.GetKey() == Keyboard::Key::KEY_W)
 				{
 					camera.MoveUp(1.0f);
 				} 
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_S)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_S)
 				{
 					camera.MoveDown(1.0f);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_A)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_A)
 				{
 					camera.MoveLeft(1.0f);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_D)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_D)
 				{
 					camera.MoveRight(1.0f);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_Q)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_Q)
 				{
 					camera.MoveForward(1.0f);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_E)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_E)
 				{
 					camera.MoveBackward(1.0f);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_R)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_R)
 				{
 					camera.Rotate(0, 1);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_F)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_F)
 				{
 					camera.Rotate(0, -1);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_Z)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_Z)
 				{
 					camera.Rotate(1, 0);
 				}
-				else if (keyevent->GetKey() == Keyboard::Key::KEY_C)
+				else if (keyevent.GetKey() == Keyboard::Key::KEY_C)
 				{
 					camera.Rotate(-1, 0);
 				}
-				//LOG_DEBUG("{}",keyevent->ToString());
+				//LOG_DEBUG("{}",keyevent.ToString());
 		}
         virtual ~OpenGLRenderer();
 
-        virtual void Render() override;
+	protected:
+		virtual void PrepareFrame(RenderFrame& frame) override;
+		virtual void DrawFrame(RenderFrame& frame) override;
+
 	private:
 		OpenGLCamera camera;
-		Square* square;
+		Square* square = nullptr;
+
+		int m_viewportWidth = 0;
+		int m_viewportHeight = 0;
+		int m_drawnViewportWidth = 0;
+		int m_drawnViewportHeight = 0;
+
+		Events::SubscriptionToken m_keyPressedSubscription;
+		Events::SubscriptionToken m_windowResizeSubscription;
     };
 }
@@ -21,9 +21,9 @@ namespace IneptEngine::Rendering {
 
 		
 		// Set a uniform value of type int
-		void SetUniform(const std::string& name, int value)
+		void SetUniform(const char* name, int value)
 		{
-			GLint location = glGetUniformLocation(m_program, name.c_str());
+			GLint location = glGetUniformLocation(m_program, name);
 			if (location != -1)
 			{
 				glUniform1i(location, value);
@@ -31,9 +31,9 @@ namespace IneptEngine::Rendering {
 		}
 
 		// Set a uniform value of type float
-		void SetUniform(const std::string& name, float value)
+		void SetUniform(const char* name, float value)
 		{
-			GLint location = glGetUniformLocation(m_program, name.c_str());
+			GLint location = glGetUniformLocation(m_program, name);
 			if (location != -1)
 			{
 				glUniform1f(location, value);
@@ -41,9 +41,9 @@ namespace IneptEngine::Rendering {
 		}
 
 		// Set a uniform value of type vec3
-		void SetUniform(const std::string& name, const glm::vec3& value)
+		void SetUniform(const char* name, const glm::vec3& value)
 		{
-			GLint location = glGetUniformLocation(m_program, name.c_str());
+			GLint location = glGetUniformLocation(m_program, name);
 			if (location != -1)
 			{
 				glUniform3fv(location, 1, &value[0]);
@@ -51,9 +51,9 @@ namespace IneptEngine::Rendering {
 		}
 
 		// Set a uniform value of type vec4
-		void SetUniform(const std::string& name, const glm::vec4& value)
+		void SetUniform(const char* name, const glm::vec4& value)
 		{
-			GLint location = glGetUniformLocation(m_program, name.c_str());
+			GLint location = glGetUniformLocation(m_program, name);
 			if (location != -1)
 			{
 				glUniform4fv(location, 1, &value[0]);
@@ -61,9 +61,9 @@ namespace IneptEngine::Rendering {
 		}
 
 		// Set a uniform value of type mat4
-		void SetUniform(const std::string& name, const glm::mat4& value)
+		void SetUniform(const char* name, const glm::mat4& value)
 		{
-			GLint location = glGetUniformLocation(m_program, name.c_str());
+			GLint location = glGetUniformLocation(m_program, name);
 			if (location != -1)
 			{
 				glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Rendering/OpenGL/OpenGLPolygon.h>
+#include <Core/MemoryTracker.h>
 
 #include <glm.hpp>
 
@@ -23,10 +24,13 @@ namespace IneptEngine::Rendering {
                 2, 3, 0
             };
 
-            m_polygon = new OpenGLPolygon(vertices, indices);
+            m_polygon = INEPT_NEW(Rendering) OpenGLPolygon(vertices, indices);
         }
 
-        virtual ~Square() {}
+        Square(const Square&) = delete;
+        Square& operator=(const Square&) = delete;
+
+        virtual ~Square() { delete m_polygon; }
 
         virtual OpenGLShader* GetShader() { return m_polygon->GetShader(); }
 
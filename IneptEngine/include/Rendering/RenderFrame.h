@@ -0,0 +1,72 @@
+#pragma once
+
+#include <iepch.h>
+
+#include <Core/InplaceFunction.h>
+
+#include <glm.hpp>
+
+namespace IneptEngine::Rendering {
+    /**
+     * @brief A rendering command recorded into a frame, run on the thread that owns the rendering context
+     *
+     * Commands run after the simulation has moved on, so they must capture the state they draw by value.
+     */
+    using RenderCommand = Core::InplaceFunction<void(), 64>;
+
+    /**
+     * @class RenderFrame
+     * @brief Snapshot of everything needed to draw one frame, recorded by the simulation and consumed by the renderer
+     *
+     * The Renderer keeps two frames: with pipelined rendering the render thread draws one while the main thread
+     * records the next into the other, so nothing in a frame may point at state the simulation keeps changing.
+     * Recorded commands are cleared once the frame is drawn, the storage is kept for the next frame.
+     */
+    class RenderFrame {
+    public:
+        /**
+         * @brief Records a command to run when the frame is drawn
+         * @param command The command, it must only capture values
+         */
+        void Submit(RenderCommand command) { m_commands.push_back(std::move(command)); }
+
+        /**
+         * @brief Runs the recorded commands in the order they were submitted
+         */
+        void ExecuteCommands() {
+            for (RenderCommand& command : m_commands) {
+                command();
+            }
+        }
+
+        /**
+         * @brief Removes the recorded commands
+         */
+        void Clear() { m_commands.clear(); }
+
+        /**
+         * @brief The number of the frame, counting from zero
+         */
+        uint64_t index = 0;
+
+        /**
+         * @brief How far the time is between the last two simulation steps, see Layer::OnRender
+         */
+        float alpha = 1.0f;
+
+        /**
+         * @brief The camera the frame is drawn from
+         */
+        glm::mat4 viewMatrix = glm::mat4(1.0f);
+        glm::mat4 projectionMatrix = glm::mat4(1.0f);
+
+        /**
+         * @brief The size of the area drawn to in pixels, zero to leave the viewport unchanged
+         */
+        int viewportWidth = 0;
+        int viewportHeight = 0;
+
+    private:
+        std::vector<RenderCommand> m_commands;
+    };
+} // namespace IneptEngine::Rendering
@@ -1,17 +1,55 @@
 #pragma once
 #include "Context.h"
+#include "RenderFrame.h"
 
 namespace IneptEngine::Rendering {
     enum RenderingAPI {
         OpenGL,
+        Null,
     };
 
+    /**
+     * @class Renderer
+     * @brief Draws the frames of a window, either on the main thread or pipelined on a render thread
+     *
+     * Every frame is recorded into a RenderFrame on the main thread and then drawn from it. Without pipelining the
+     * frame is drawn right away. With pipelining a render thread owns the rendering context and draws frame N while
+     * the main thread simulates and records frame N+1, so a frame costs the longer of the two instead of their sum,
+     * at the price of one frame of latency. Render blocks while the render thread is still busy with the previous
+     * frame, which keeps the main thread at most one frame ahead.
+     */
     class Renderer {
     public:
         Renderer(IneptEngine::Windowing::Window* window) : m_window(window) {}
-        virtual ~Renderer() = default;
 
-        virtual void Render() = 0;
+        /**
+         * @brief Derived renderers must stop pipelining in their destructor, the render thread calls into them
+         */
+        virtual ~Renderer();
+
+        /**
+         * @brief Finishes recording the current frame and draws it, or hands it to the render thread
+         */
+        void Render();
+
+        /**
+         * @brief Gets the frame being recorded, only to be used on the main thread
+         */
+        RenderFrame& GetFrame() { return m_frames[m_recordIndex]; }
+
+        /**
+         * @brief Starts or stops drawing frames on a render thread
+         *
+         * Stopping draws the frame in flight and gives the rendering context back to the calling thread.
+         *
+         * @param pipelined True to draw on a render thread
+         */
+        void SetPipelined(bool pipelined);
+
+        /**
+         * @brief Checks if frames are drawn on a render thread
+         */
+        bool IsPipelined() const { return m_renderThread.joinable(); }
 
         virtual IneptEngine::Windowing::Window* GetWindow() { return m_window; }
         virtual bool VSyncEnabled() { return m_vsyncEnabled; }
@@ -20,8 +58,34 @@ namespace IneptEngine::Rendering {
         static Renderer* CreateRenderer(IneptEngine::Windowing::Window* window, RenderingAPI api);
 
     protected:
-        Context* m_context;
+        /**
+         * @brief Copies the renderer's own state the frame is drawn with into the frame, called on the main thread
+         */
+        virtual void PrepareFrame(RenderFrame& frame) {}
+
+        /**
+         * @brief Draws a frame, called on the thread that owns the rendering context
+         */
+        virtual void DrawFrame(RenderFrame& frame) = 0;
+
+        Context* m_context = nullptr;
         IneptEngine::Windowing::Window* m_window;
         bool m_vsyncEnabled = true;
+
+    private:
+        void RenderLoop();
+
+        std::array<RenderFrame, 2> m_frames;
+        size_t m_recordIndex = 0;
+        uint64_t m_frameIndex = 0;
+
+        std::thread m_renderThread;
+        std::mutex m_renderMutex;
+        std::condition_variable m_frameReady;
+        std::condition_variable m_frameDone;
+
+        // The frame handed to the render thread, reset once it is drawn
+        RenderFrame* m_pendingFrame = nullptr;
+        bool m_stopRendering = false;
     };
 }
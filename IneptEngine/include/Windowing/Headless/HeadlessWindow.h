@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Windowing/Window.h>
+
+namespace IneptEngine::Windowing
+{
+    /*
+     * @brief A window that is never shown, for running the engine loop without a display, e.g on build machines.
+     * It keeps the state a real window would have and draws its frames with whichever renderer is created for it,
+     * usually the null renderer.
+     */
+    class HeadlessWindow : public Window
+    {
+    public:
+        HeadlessWindow(Window* parent = nullptr, int width = 800, int height = 600, const std::string title = "Inept Window");
+
+        HeadlessWindow(const HeadlessWindow&) = delete;
+        HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+        HeadlessWindow(HeadlessWindow&&) = delete;
+        HeadlessWindow& operator=(HeadlessWindow&&) = delete;
+
+        virtual ~HeadlessWindow();
+        virtual void Update() override;
+        virtual void Close() override;
+
+        virtual void Show() override;
+        virtual void Hide() override;
+        virtual bool IsVisible() override;
+
+        virtual void Move(int x, int y) override;
+        virtual void Resize(int width, int height) override;
+
+        virtual bool IsMaximized() override;
+        virtual bool IsMinimized() override;
+        virtual void Minimize() override;
+        virtual void Maximize() override;
+        virtual void Restore() override;
+
+        virtual void ShowFullScreen() override;
+        virtual void CloseFullScreen() override;
+        virtual void SetFullscreen(bool fullscreen) override;
+        virtual bool IsFocused() override;
+
+        virtual void SetTitle(const std::string title) override;
+        virtual const std::string GetTitle() override;
+
+        virtual void SetPosition(int x, int y) override;
+        virtual void SetSize(int width, int height) override;
+        virtual int GetWidth() override;
+        virtual int GetHeight() override;
+
+        virtual void AddChild(Window* child) override;
+        virtual void RemoveChild(Window* child) override;
+        virtual void RemoveAllChildren() override;
+
+        virtual Window* GetParentWindow() override;
+        virtual void SetParentWindow(Window* parent) override;
+
+    protected:
+        virtual void Create(Window* parent = nullptr, int width = 800, int height = 600, const std::string title = "Inept Window") override;
+
+    private:
+        std::string m_title;
+        int m_x = 0;
+        int m_y = 0;
+        int m_width = 0;
+        int m_height = 0;
+        bool m_visible = false;
+        bool m_minimized = false;
+        bool m_maximized = false;
+        bool m_fullscreen = false;
+        std::vector<Window*> m_children;
+    };
+}//namespace IneptEngine::Windowing
@@ -23,6 +23,12 @@ namespace IneptEngine::Windowing
 
         // Static create function for cross platform support of WindowBase
         static Window* CreateIneptWindow(Window* parent = nullptr, int width = 800, int height = 600, const std::string title = "Inept Window");
+
+        /*
+         * @brief Creates a window that is never shown, on any platform.
+         * @return The window, it has no renderer until one is created for it.
+         */
+        static Window* CreateHeadlessWindow(Window* parent = nullptr, int width = 800, int height = 600, const std::string title = "Inept Window");
         /*
          * @brief Constructor for the Window class.
          * @param parent A pointer to the parent window.
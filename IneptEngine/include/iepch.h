@@ -5,26 +5,41 @@
 #include <Windows.h>
 #include <Windowsx.h>
 #include <wingdi.h>
+#include <debugapi.h>
 #endif // INEPT_PLATFORM_WINDOWS
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
 
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <span>
 #include <format>
 
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 #include <vector>
+#include <array>
+#include <variant>
 #include <map>
+#include <algorithm>
+#include <deque>
+#include <tuple>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <chrono>
-
-#include <debugapi.h>
+#include <cmath>
+#include <bit>
 
 
 //#include <Logging/Log.h>
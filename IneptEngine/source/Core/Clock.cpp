@@ -0,0 +1,91 @@
+#include <Core/Clock.h>
+
+#if defined(INEPT_CLOCK_TSC) && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+
+namespace IneptEngine::Core {
+
+	const Clock::Calibration& Clock::GetCalibration()
+	{
+		static const Calibration calibration = []() {
+			using namespace std::chrono;
+
+			double nanosecondsPerTick = 1.0;
+			if (IsUsingTimeStampCounter()) {
+				// Counts ticks over a short steady_clock interval, long enough for the clock reads themselves to be negligible
+				constexpr nanoseconds calibrationTime = milliseconds(10);
+
+				steady_clock::time_point steadyStart = steady_clock::now();
+				Ticks ticksStart = Now();
+				steady_clock::time_point steadyEnd;
+				do {
+					steadyEnd = steady_clock::now();
+				} while (steadyEnd - steadyStart < calibrationTime);
+				Ticks ticksEnd = Now();
+
+				nanosecondsPerTick = static_cast<double>(duration_cast<nanoseconds>(steadyEnd - steadyStart).count()) / static_cast<double>(ticksEnd - ticksStart);
+			}
+			return Calibration{ Now(), system_clock::now(), nanosecondsPerTick };
+		}();
+		return calibration;
+	}
+
+#ifdef INEPT_CLOCK_TSC
+	bool Clock::HasInvariantTimeStampCounter()
+	{
+		// Leaf 0x80000007 reports the invariant TSC in bit 8 of EDX, if the CPU has that leaf at all
+		constexpr unsigned int powerManagementLeaf = 0x80000007;
+		constexpr unsigned int invariantTscBit = 1u << 8;
+#ifdef _MSC_VER
+		int registers[4];
+		__cpuid(registers, 0x80000000);
+		if (static_cast<unsigned int>(registers[0]) < powerManagementLeaf) {
+			return false;
+		}
+		__cpuid(registers, static_cast<int>(powerManagementLeaf));
+		return (static_cast<unsigned int>(registers[3]) & invariantTscBit) != 0;
+#else
+		unsigned int eax, ebx, ecx, edx;
+		if (!__get_cpuid(powerManagementLeaf, &eax, &ebx, &ecx, &edx)) {
+			return false;
+		}
+		return (edx & invariantTscBit) != 0;
+#endif
+	}
+#endif
+
+	std::chrono::system_clock::time_point Clock::ToSystemTime(Ticks timestamp)
+	{
+		const Calibration& calibration = GetCalibration();
+		if (timestamp >= calibration.startTicks) {
+			return calibration.startTime + std::chrono::nanoseconds(ToNanoseconds(timestamp - calibration.startTicks));
+		}
+		return calibration.startTime - std::chrono::nanoseconds(ToNanoseconds(calibration.startTicks - timestamp));
+	}
+
+	std::string Clock::FormatTime(Ticks timestamp)
+	{
+		using namespace std::chrono;
+
+		system_clock::time_point time = ToSystemTime(timestamp);
+		sys_seconds second = floor<seconds>(time);
+
+		// Converting to local time looks up the time zone database, so the text of the last second is reused
+		thread_local sys_seconds cachedSecond = sys_seconds::min();
+		thread_local std::string cachedText;
+		if (second != cachedSecond) {
+			cachedText = std::format("{:%T}", zoned_time(current_zone(), second));
+			cachedSecond = second;
+		}
+		auto millisecond = static_cast<unsigned int>(duration_cast<milliseconds>(time - second).count());
+		std::string text;
+		text.reserve(cachedText.size() + 4);
+		text += cachedText;
+		text += '.';
+		text += static_cast<char>('0' + millisecond / 100);
+		text += static_cast<char>('0' + millisecond / 10 % 10);
+		text += static_cast<char>('0' + millisecond % 10);
+		return text;
+	}
+} // namespace IneptEngine::Core
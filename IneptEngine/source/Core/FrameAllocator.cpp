@@ -0,0 +1,125 @@
+#include <Core/FrameAllocator.h>
+#include <Core/MemoryTracker.h>
+
+namespace IneptEngine::Core {
+
+	namespace {
+		// Every thread's allocator, so the stats can be summed
+		struct FrameAllocatorRegistry {
+			std::mutex mutex;
+			std::vector<FrameAllocator*> allocators;
+		};
+
+		FrameAllocatorRegistry& GetRegistry()
+		{
+			static FrameAllocatorRegistry registry;
+			return registry;
+		}
+	}
+
+	FrameAllocator& FrameAllocator::Get()
+	{
+		thread_local FrameAllocator allocator;
+		return allocator;
+	}
+
+	std::pmr::memory_resource* FrameAllocator::GetMemoryResource()
+	{
+		static FrameMemoryResource resource;
+		return &resource;
+	}
+
+	FrameAllocatorStats FrameAllocator::GetStats()
+	{
+		FrameAllocatorStats stats = {};
+		stats.frameIndex = GetFrameIndex();
+
+		FrameAllocatorRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		stats.threadCount = registry.allocators.size();
+		for (FrameAllocator* allocator : registry.allocators) {
+			stats.lastFrameBytes += allocator->m_lastFrameBytes.load(std::memory_order_relaxed);
+			stats.peakFrameBytes += allocator->m_peakFrameBytes.load(std::memory_order_relaxed);
+			stats.reservedBytes += allocator->m_reservedBytes.load(std::memory_order_relaxed);
+			stats.heapAllocations += allocator->m_heapAllocations.load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+	FrameAllocator::FrameAllocator()
+	{
+		m_frame = GetFrameIndex();
+
+		FrameAllocatorRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.allocators.push_back(this);
+	}
+
+	FrameAllocator::~FrameAllocator()
+	{
+		FrameAllocatorRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.allocators.erase(std::find(registry.allocators.begin(), registry.allocators.end(), this));
+	}
+
+	void FrameAllocator::SwitchArena(uint64_t frame)
+	{
+		size_t usedBytes = GetUsedBytes();
+		m_lastFrameBytes.store(usedBytes, std::memory_order_relaxed);
+		if (usedBytes > m_peakFrameBytes.load(std::memory_order_relaxed)) {
+			m_peakFrameBytes.store(usedBytes, std::memory_order_relaxed);
+		}
+
+		m_currentArena ^= 1;
+		m_frame = frame;
+
+		// The other arena holds memory from two or more frames ago, which nobody may use anymore
+		Arena& arena = m_arenas[m_currentArena];
+		if (arena.blocks.size() > 1) {
+			size_t totalSize = 0;
+			for (const auto& [block, size] : arena.blocks) {
+				totalSize += size;
+			}
+			ResetArena(arena, std::bit_ceil(totalSize));
+		}
+		arena.cursor = arena.blockStart;
+		arena.fullBlockBytes = 0;
+	}
+
+	void* FrameAllocator::AllocateBlock(size_t size, size_t alignment)
+	{
+		Arena& arena = m_arenas[m_currentArena];
+		arena.fullBlockBytes += static_cast<size_t>(arena.cursor - arena.blockStart);
+
+		// Blocks double in size so a frame that needs much more memory than before only takes a few of them
+		size_t blockSize = arena.blocks.empty() ? InitialBlockSize : arena.blocks.back().second * 2;
+		blockSize = (std::max)(blockSize, std::bit_ceil(size + alignment));
+
+		MEMORY_TAG_SCOPE(Core);
+		arena.blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize);
+		arena.blockStart = arena.blocks.back().first.get();
+		arena.cursor = arena.blockStart;
+		arena.end = arena.blockStart + blockSize;
+		m_reservedBytes.fetch_add(blockSize, std::memory_order_relaxed);
+		m_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		uintptr_t address = (reinterpret_cast<uintptr_t>(arena.cursor) + (alignment - 1)) & ~(alignment - 1);
+		arena.cursor = reinterpret_cast<std::byte*>(address + size);
+		return reinterpret_cast<void*>(address);
+	}
+
+	void FrameAllocator::ResetArena(Arena& arena, size_t size)
+	{
+		for (const auto& [block, blockSize] : arena.blocks) {
+			m_reservedBytes.fetch_sub(blockSize, std::memory_order_relaxed);
+		}
+		arena.blocks.clear();
+
+		MEMORY_TAG_SCOPE(Core);
+		arena.blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size), size);
+		arena.blockStart = arena.blocks.back().first.get();
+		arena.end = arena.blockStart + size;
+		m_reservedBytes.fetch_add(size, std::memory_order_relaxed);
+		m_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+	}
+} // namespace IneptEngine::Core
@@ -0,0 +1,276 @@
+#include <Core/JobSystem.h>
+#include <Core/Profiler.h>
+#include <Core/MemoryTracker.h>
+
+namespace IneptEngine::Core {
+
+	namespace {
+		// The worker the calling thread runs as, valid while the generation matches the job system's
+		thread_local void* t_worker = nullptr;
+		thread_local uint64_t t_workerGeneration = 0;
+	}
+
+	/**
+	 * @brief Job entries freed on a thread, reused by the next jobs it submits
+	 *
+	 * Entries are freed by the thread that ran them, so they drift from submitting threads to the threads that
+	 * steal, each cache is bounded and frees what does not fit.
+	 */
+	struct JobSystem::EntryCache {
+		static constexpr size_t MaxEntries = 1024;
+
+		std::vector<JobEntry*> entries;
+
+		~EntryCache() {
+			for (JobEntry* entry : entries) {
+				delete entry;
+			}
+		}
+	};
+
+	JobSystem& JobSystem::GetInstance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	JobSystem::JobSystem()
+	{
+		// Worker zero is left to the main thread, the first thread to get the system may be any thread
+		StartWorkers(std::thread::hardware_concurrency(), false);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		StopWorkers();
+	}
+
+	void JobSystem::SetThreadCount(size_t threadCount)
+	{
+		MEMORY_TAG_SCOPE(Core);
+		StopWorkers();
+		StartWorkers(threadCount != 0 ? threadCount : std::thread::hardware_concurrency(), true);
+	}
+
+	void JobSystem::SetMainThread()
+	{
+		std::thread::id thread = std::this_thread::get_id();
+		if (thread == m_mainThread) {
+			return;
+		}
+		if (m_mainThread != std::thread::id()) {
+			// Restarting is the only way to take worker zero away from the thread holding it
+			SetThreadCount(GetThreadCount());
+			return;
+		}
+		m_mainThread = thread;
+		t_worker = m_workers[0].get();
+		t_workerGeneration = m_generation;
+	}
+
+	void JobSystem::StartWorkers(size_t threadCount, bool bindCaller)
+	{
+		threadCount = (std::max)(threadCount, size_t(1));
+		m_generation++;
+		m_stopping.store(false);
+
+		for (size_t i = 0; i < threadCount; i++) {
+			m_workers.push_back(std::make_unique<Worker>());
+			m_workers.back()->index = i;
+		}
+
+		m_mainThread = std::thread::id();
+		if (bindCaller) {
+			m_mainThread = std::this_thread::get_id();
+			t_worker = m_workers[0].get();
+			t_workerGeneration = m_generation;
+		}
+		for (size_t i = 1; i < threadCount; i++) {
+			m_workers[i]->thread = std::thread([this, i]() { WorkerLoop(i); });
+		}
+	}
+
+	void JobSystem::StopWorkers()
+	{
+		m_stopping.store(true);
+		m_wakeSignal.fetch_add(1);
+		m_wakeSignal.notify_all();
+		for (std::unique_ptr<Worker>& worker : m_workers) {
+			if (worker->thread.joinable()) {
+				worker->thread.join();
+			}
+		}
+		m_workers.clear();
+	}
+
+	JobSystem::Worker* JobSystem::GetThreadWorker() const
+	{
+		return t_workerGeneration == m_generation ? static_cast<Worker*>(t_worker) : nullptr;
+	}
+
+	void JobSystem::Submit(Job job, JobCounter* counter)
+	{
+		if (counter != nullptr) {
+			counter->m_count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		JobEntry* entry = AllocateEntry();
+		entry->job = std::move(job);
+		entry->counter = counter;
+
+		if (IsSingleThreaded()) {
+			Run(entry);
+			return;
+		}
+
+		if (Worker* worker = GetThreadWorker()) {
+			// A full deque means there is plenty of work queued already, running the job now is as good as any
+			if (!worker->jobs.Push(entry)) {
+				Run(entry);
+				return;
+			}
+		}
+		else {
+			std::lock_guard<std::mutex> lock(m_sharedJobsMutex);
+			m_sharedJobs.push_back(entry);
+			m_sharedJobCount.fetch_add(1, std::memory_order_release);
+		}
+		WakeWorker();
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		Worker* worker = GetThreadWorker();
+		uint32_t idleCount = 0;
+		while (!counter.IsDone()) {
+			if (JobEntry* entry = FindJob(worker)) {
+				Run(entry);
+				idleCount = 0;
+			}
+			else if (++idleCount >= IdleSpinCount) {
+				// The last jobs of the group are running elsewhere
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::WorkerLoop(size_t index)
+	{
+		Worker* worker = m_workers[index].get();
+		t_worker = worker;
+		t_workerGeneration = m_generation;
+		Profiler::SetThreadName(std::format("Job worker {}", index));
+
+		uint32_t idleCount = 0;
+		while (!m_stopping.load(std::memory_order_relaxed)) {
+			if (JobEntry* entry = FindJob(worker)) {
+				Run(entry);
+				idleCount = 0;
+				continue;
+			}
+			if (++idleCount < IdleSpinCount) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Reading the signal before searching once more means a job submitted after the search changes it,
+			// so the wait returns right away instead of missing the wake up
+			uint32_t signal = m_wakeSignal.load();
+			if (JobEntry* entry = FindJob(worker)) {
+				Run(entry);
+				idleCount = 0;
+				continue;
+			}
+			m_sleepingWorkers.fetch_add(1);
+			if (!m_stopping.load()) {
+				m_wakeSignal.wait(signal);
+			}
+			m_sleepingWorkers.fetch_sub(1);
+			idleCount = 0;
+		}
+	}
+
+	JobSystem::JobEntry* JobSystem::FindJob(Worker* worker)
+	{
+		if (worker != nullptr) {
+			if (JobEntry* entry = worker->jobs.Pop()) {
+				return entry;
+			}
+		}
+
+		if (m_sharedJobCount.load(std::memory_order_acquire) != 0) {
+			std::lock_guard<std::mutex> lock(m_sharedJobsMutex);
+			if (!m_sharedJobs.empty()) {
+				JobEntry* entry = m_sharedJobs.front();
+				m_sharedJobs.pop_front();
+				m_sharedJobCount.fetch_sub(1, std::memory_order_relaxed);
+				return entry;
+			}
+		}
+
+		// Victims are tried starting after the worker itself, so thieves spread out instead of all hitting worker zero
+		size_t workerCount = m_workers.size();
+		size_t first = worker != nullptr ? worker->index : 0;
+		for (size_t i = 0; i < workerCount; i++) {
+			Worker* victim = m_workers[(first + i) % workerCount].get();
+			if (victim == worker) {
+				continue;
+			}
+			if (JobEntry* entry = victim->jobs.Steal()) {
+				return entry;
+			}
+		}
+		return nullptr;
+	}
+
+	void JobSystem::Run(JobEntry* entry)
+	{
+		{
+			PROFILE_SCOPE("Job");
+			entry->job();
+		}
+		entry->job = Job();
+
+		JobCounter* counter = entry->counter;
+		FreeEntry(entry);
+		if (counter != nullptr) {
+			counter->m_count.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	void JobSystem::WakeWorker()
+	{
+		// Pairs with the sleeping worker reading the signal before its last search, see WorkerLoop
+		m_wakeSignal.fetch_add(1);
+		if (m_sleepingWorkers.load() != 0) {
+			m_wakeSignal.notify_one();
+		}
+	}
+
+	JobSystem::EntryCache& JobSystem::GetEntryCache()
+	{
+		thread_local EntryCache cache;
+		return cache;
+	}
+
+	JobSystem::JobEntry* JobSystem::AllocateEntry()
+	{
+		EntryCache& cache = GetEntryCache();
+		if (cache.entries.empty()) {
+			return new JobEntry();
+		}
+		JobEntry* entry = cache.entries.back();
+		cache.entries.pop_back();
+		return entry;
+	}
+
+	void JobSystem::FreeEntry(JobEntry* entry)
+	{
+		EntryCache& cache = GetEntryCache();
+		if (cache.entries.size() >= EntryCache::MaxEntries) {
+			delete entry;
+			return;
+		}
+		cache.entries.push_back(entry);
+	}
+} // namespace IneptEngine::Core
@@ -0,0 +1,202 @@
+#include <Core/MappedFile.h>
+
+#include <Logging/Log.h>
+
+#ifndef INEPT_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace IneptEngine::Core {
+#ifdef INEPT_PLATFORM_WINDOWS
+	bool MappedFile::OpenForWriting(const std::string& path)
+	{
+		Close();
+		m_file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		m_writable = true;
+		if (!Map(GrowSize)) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	bool MappedFile::OpenForReading(const std::string& path)
+	{
+		Close();
+		m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_file, &size)) {
+			Close();
+			return false;
+		}
+		m_size = static_cast<size_t>(size.QuadPart);
+
+		// An empty file cannot be mapped, it is simply open with no data
+		if (m_size != 0 && !Map(m_size)) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	bool MappedFile::Map(size_t capacity)
+	{
+		Unmap();
+		m_mapping = CreateFileMappingA(m_file, nullptr, m_writable ? PAGE_READWRITE : PAGE_READONLY,
+			static_cast<DWORD>(static_cast<uint64_t>(capacity) >> 32), static_cast<DWORD>(capacity), nullptr);
+		if (m_mapping == nullptr) {
+			return false;
+		}
+
+		m_data = static_cast<std::byte*>(MapViewOfFile(m_mapping, m_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, capacity));
+		if (m_data == nullptr) {
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+			return false;
+		}
+		m_capacity = capacity;
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (m_data != nullptr) {
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+		if (m_mapping != nullptr) {
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+		m_capacity = 0;
+	}
+
+	void MappedFile::Close()
+	{
+		Unmap();
+		if (m_file != INVALID_HANDLE_VALUE) {
+			if (m_writable) {
+				// The mapping grew the file in steps, cut off the unused tail
+				LARGE_INTEGER size;
+				size.QuadPart = static_cast<LONGLONG>(m_size);
+				if (!SetFilePointerEx(m_file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(m_file)) {
+					LOG_WARNING("Could not truncate mapped file to {} bytes, its tail stays zero filled", m_size);
+				}
+			}
+			CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+		}
+		m_size = 0;
+		m_writable = false;
+	}
+#else
+	bool MappedFile::OpenForWriting(const std::string& path)
+	{
+		Close();
+		m_file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if (m_file < 0) {
+			return false;
+		}
+		m_writable = true;
+		if (!Map(GrowSize)) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	bool MappedFile::OpenForReading(const std::string& path)
+	{
+		Close();
+		m_file = open(path.c_str(), O_RDONLY);
+		if (m_file < 0) {
+			return false;
+		}
+
+		struct stat status;
+		if (fstat(m_file, &status) != 0) {
+			Close();
+			return false;
+		}
+		m_size = static_cast<size_t>(status.st_size);
+
+		// An empty file cannot be mapped, it is simply open with no data
+		if (m_size != 0 && !Map(m_size)) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	bool MappedFile::Map(size_t capacity)
+	{
+		Unmap();
+		if (m_writable && ftruncate(m_file, static_cast<off_t>(capacity)) != 0) {
+			return false;
+		}
+
+		void* data = mmap(nullptr, capacity, m_writable ? PROT_READ | PROT_WRITE : PROT_READ, m_writable ? MAP_SHARED : MAP_PRIVATE, m_file, 0);
+		if (data == MAP_FAILED) {
+			return false;
+		}
+		m_data = static_cast<std::byte*>(data);
+		m_capacity = capacity;
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (m_data != nullptr) {
+			munmap(m_data, m_capacity);
+			m_data = nullptr;
+		}
+		m_capacity = 0;
+	}
+
+	void MappedFile::Close()
+	{
+		Unmap();
+		if (m_file >= 0) {
+			if (m_writable) {
+				// The mapping grew the file in steps, cut off the unused tail
+				if (ftruncate(m_file, static_cast<off_t>(m_size)) != 0) {
+					LOG_WARNING("Could not truncate mapped file to {} bytes, its tail stays zero filled", m_size);
+				}
+			}
+			close(m_file);
+			m_file = -1;
+		}
+		m_size = 0;
+		m_writable = false;
+	}
+#endif
+
+	bool MappedFile::Append(const void* data, size_t size)
+	{
+		if (!m_writable) {
+			return false;
+		}
+
+		if (m_size + size > m_capacity) {
+			// Grow geometrically so a long recording only remaps a handful of times
+			size_t capacity = (std::max)(m_capacity * 2, m_size + size + GrowSize);
+			if (!Map(capacity)) {
+				return false;
+			}
+		}
+
+		std::memcpy(m_data + m_size, data, size);
+		m_size += size;
+		return true;
+	}
+} // namespace IneptEngine::Core
@@ -0,0 +1,437 @@
+#include <Core/MemoryTracker.h>
+#include <Core/ThreadNodeList.h>
+
+#include <Logging/Log.h>
+
+namespace IneptEngine::Core {
+
+	namespace {
+		constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+		// Stored in front of every allocation, its size keeps the memory after it aligned like malloc's
+		struct AllocationHeader {
+			uint64_t size;
+			uint32_t offset;
+			uint16_t callSite;
+			MemoryTag tag;
+			uint8_t reserved;
+		};
+		constexpr size_t HeaderSize = 16;
+		static_assert(sizeof(AllocationHeader) == HeaderSize);
+		static_assert(HeaderSize % alignof(std::max_align_t) == 0);
+
+		// Only written by the owning thread, so updates are a load and a store rather than atomic read-modify-writes
+		struct TagCounters {
+			std::atomic<uint64_t> allocatedBytes;
+			std::atomic<uint64_t> freedBytes;
+			std::atomic<uint64_t> allocations;
+			std::atomic<uint64_t> frees;
+		};
+
+		void Add(std::atomic<uint64_t>& counter, uint64_t value)
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+
+		// The counters of one thread, handed to another thread once it exits so the totals are kept
+		struct ThreadCounters {
+			std::array<TagCounters, TagCount> tags;
+		};
+
+		struct CallSiteCounters {
+			MemoryCallSite site;
+			std::atomic<int64_t> liveBytes;
+			std::atomic<int64_t> liveAllocations;
+		};
+
+		// Used from operator new before any constructor runs, so everything in here is constant initialized and
+		// nothing allocates through operator new itself
+		struct TrackerState {
+			ThreadNodeList<ThreadCounters> threads;
+
+			std::atomic_flag callSiteLock;
+			std::atomic<uint32_t> callSiteCount = 1;
+			std::array<CallSiteCounters, MemoryTracker::MaxCallSites> callSites;
+			std::array<MemoryCallSite, TagCount> overflowCallSites;
+			std::atomic<bool> captureCallSites = false;
+
+			std::array<std::atomic<uint64_t>, TagCount> budgets;
+			std::array<std::atomic<bool>, TagCount> overBudget;
+		};
+
+		constinit TrackerState s_state;
+
+		thread_local ThreadCounters* t_counters = nullptr;
+
+		// Hands the counters back when the thread exits
+		struct ThreadCountersHandle : ThreadNodeHandle<ThreadCounters> {
+			~ThreadCountersHandle() {
+				t_counters = nullptr;
+			}
+		};
+
+		thread_local ThreadCountersHandle t_countersHandle;
+
+		ThreadCounters* AcquireThreadCounters()
+		{
+			// Allocated with malloc, operator new would come back here
+			ThreadNodeList<ThreadCounters>::Node* node = s_state.threads.Acquire([]() {
+				void* memory = std::malloc(sizeof(ThreadNodeList<ThreadCounters>::Node));
+				if (memory == nullptr) {
+					std::abort();
+				}
+				return new (memory) ThreadNodeList<ThreadCounters>::Node();
+				});
+
+			t_countersHandle.Set(node);
+			t_counters = &node->value;
+			return t_counters;
+		}
+
+		ThreadCounters* GetThreadCounters()
+		{
+			return t_counters != nullptr ? t_counters : AcquireThreadCounters();
+		}
+
+		void* AllocateOrThrow(size_t size, size_t alignment, MemoryTag tag, uint16_t callSite)
+		{
+			for (;;) {
+				if (void* memory = MemoryTracker::Allocate(size, alignment, tag, callSite)) {
+					return memory;
+				}
+				std::new_handler handler = std::get_new_handler();
+				if (handler == nullptr) {
+					throw std::bad_alloc();
+				}
+				handler();
+			}
+		}
+
+		uint16_t GetCapturedCallSite(const MemoryCallSite& site)
+		{
+			return s_state.captureCallSites.load(std::memory_order_relaxed) ? site.index : 0;
+		}
+	}
+
+	MemorySnapshot MemorySnapshot::Diff(const MemorySnapshot& before) const
+	{
+		MemorySnapshot diff;
+		for (size_t i = 0; i < TagCount; i++) {
+			diff.tags[i].liveBytes = tags[i].liveBytes - before.tags[i].liveBytes;
+			diff.tags[i].liveAllocations = tags[i].liveAllocations - before.tags[i].liveAllocations;
+			diff.tags[i].allocatedBytes = tags[i].allocatedBytes - before.tags[i].allocatedBytes;
+			diff.tags[i].allocations = tags[i].allocations - before.tags[i].allocations;
+		}
+
+		// Both lists are ordered by call site index
+		auto earlier = before.callSites.begin();
+		for (const MemoryCallSiteStats& site : callSites) {
+			while (earlier != before.callSites.end() && earlier->index < site.index) {
+				diff.callSites.push_back(*earlier);
+				diff.callSites.back().liveBytes = -earlier->liveBytes;
+				diff.callSites.back().liveAllocations = -earlier->liveAllocations;
+				++earlier;
+			}
+			MemoryCallSiteStats change = site;
+			if (earlier != before.callSites.end() && earlier->index == site.index) {
+				change.liveBytes -= earlier->liveBytes;
+				change.liveAllocations -= earlier->liveAllocations;
+				++earlier;
+			}
+			if (change.liveBytes != 0 || change.liveAllocations != 0) {
+				diff.callSites.push_back(change);
+			}
+		}
+		for (; earlier != before.callSites.end(); ++earlier) {
+			diff.callSites.push_back(*earlier);
+			diff.callSites.back().liveBytes = -earlier->liveBytes;
+			diff.callSites.back().liveAllocations = -earlier->liveAllocations;
+		}
+
+		std::sort(diff.callSites.begin(), diff.callSites.end(), [](const MemoryCallSiteStats& a, const MemoryCallSiteStats& b) {
+			return a.liveBytes > b.liveBytes;
+			});
+		return diff;
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		switch (tag) {
+		case MemoryTag::Untagged:
+			return "Untagged";
+		case MemoryTag::Core:
+			return "Core";
+		case MemoryTag::Events:
+			return "Events";
+		case MemoryTag::Rendering:
+			return "Rendering";
+		case MemoryTag::Input:
+			return "Input";
+		case MemoryTag::Windowing:
+			return "Windowing";
+		case MemoryTag::Scripting:
+			return "Scripting";
+		case MemoryTag::Layers:
+			return "Layers";
+		case MemoryTag::Profiler:
+			return "Profiler";
+		default:
+			return "Unknown";
+		}
+	}
+
+	void* MemoryTracker::Allocate(size_t size, size_t alignment, MemoryTag tag, uint16_t callSite)
+	{
+		// Memory aligned like malloc's directly follows the header, more alignment needs room to move it forward
+		size_t slack = alignment > alignof(std::max_align_t) ? alignment : 0;
+		if (size > SIZE_MAX - HeaderSize - slack) {
+			return nullptr;
+		}
+		void* block = std::malloc(size + HeaderSize + slack);
+		if (block == nullptr) {
+			return nullptr;
+		}
+
+		uintptr_t address = reinterpret_cast<uintptr_t>(block) + HeaderSize;
+		if (slack != 0) {
+			address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+		}
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(address - HeaderSize);
+		header->size = size;
+		header->offset = static_cast<uint32_t>(address - reinterpret_cast<uintptr_t>(block));
+		header->callSite = callSite;
+		header->tag = tag;
+
+		TagCounters& counters = GetThreadCounters()->tags[static_cast<size_t>(tag)];
+		Add(counters.allocatedBytes, size);
+		Add(counters.allocations, 1);
+		if (callSite != 0) {
+			CallSiteCounters& site = s_state.callSites[callSite];
+			site.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+			site.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+		return reinterpret_cast<void*>(address);
+	}
+
+	void MemoryTracker::Free(void* memory)
+	{
+		if (memory == nullptr) {
+			return;
+		}
+
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(static_cast<std::byte*>(memory) - HeaderSize);
+		TagCounters& counters = GetThreadCounters()->tags[static_cast<size_t>(header->tag)];
+		Add(counters.freedBytes, header->size);
+		Add(counters.frees, 1);
+		if (header->callSite != 0) {
+			CallSiteCounters& site = s_state.callSites[header->callSite];
+			site.liveBytes.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+			site.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+		}
+		std::free(static_cast<std::byte*>(memory) - header->offset);
+	}
+
+	const MemoryCallSite& MemoryTracker::RegisterCallSite(MemoryTag tag, const char* file, int line)
+	{
+		while (s_state.callSiteLock.test_and_set(std::memory_order_acquire)) {
+			std::this_thread::yield();
+		}
+
+		uint32_t count = s_state.callSiteCount.load(std::memory_order_relaxed);
+		const MemoryCallSite* site = nullptr;
+		for (uint32_t i = 1; i < count; i++) {
+			const MemoryCallSite& registered = s_state.callSites[i].site;
+			if (registered.line == line && std::strcmp(registered.file, file) == 0) {
+				site = &registered;
+				break;
+			}
+		}
+
+		if (site == nullptr && count < MaxCallSites) {
+			s_state.callSites[count].site = { file, line, tag, static_cast<uint16_t>(count) };
+			site = &s_state.callSites[count].site;
+			s_state.callSiteCount.store(count + 1, std::memory_order_release);
+		}
+		else if (site == nullptr) {
+			// Without room for the site it is only counted under its tag
+			MemoryCallSite& overflow = s_state.overflowCallSites[static_cast<size_t>(tag)];
+			overflow.tag = tag;
+			site = &overflow;
+		}
+
+		s_state.callSiteLock.clear(std::memory_order_release);
+		return *site;
+	}
+
+	void MemoryTracker::SetCallSiteCapture(bool enabled)
+	{
+		s_state.captureCallSites.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool MemoryTracker::IsCapturingCallSites()
+	{
+		return s_state.captureCallSites.load(std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::SetBudget(MemoryTag tag, uint64_t bytes)
+	{
+		s_state.budgets[static_cast<size_t>(tag)].store(bytes, std::memory_order_relaxed);
+	}
+
+	uint64_t MemoryTracker::GetBudget(MemoryTag tag)
+	{
+		return s_state.budgets[static_cast<size_t>(tag)].load(std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::BeginFrame()
+	{
+		bool hasBudget = false;
+		for (const std::atomic<uint64_t>& budget : s_state.budgets) {
+			hasBudget |= budget.load(std::memory_order_relaxed) != 0;
+		}
+		if (!hasBudget) {
+			return;
+		}
+
+		MemorySnapshot snapshot = TakeSnapshot();
+		for (size_t i = 0; i < TagCount; i++) {
+			uint64_t budget = s_state.budgets[i].load(std::memory_order_relaxed);
+			bool overBudget = budget != 0 && snapshot.tags[i].liveBytes > static_cast<int64_t>(budget);
+
+			// Warns once when a tag goes over its budget, and again only after it came back under
+			if (overBudget && !s_state.overBudget[i].exchange(true, std::memory_order_relaxed)) {
+				LOG_WARNING("Memory budget exceeded: {} uses {} bytes of its {} byte budget", GetTagName(static_cast<MemoryTag>(i)), snapshot.tags[i].liveBytes, budget);
+			}
+			else if (!overBudget) {
+				s_state.overBudget[i].store(false, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	MemorySnapshot MemoryTracker::TakeSnapshot()
+	{
+		MemorySnapshot snapshot;
+		for (auto* node = s_state.threads.GetFirst(); node != nullptr; node = node->next) {
+			for (size_t i = 0; i < TagCount; i++) {
+				const TagCounters& tag = node->value.tags[i];
+				int64_t allocatedBytes = static_cast<int64_t>(tag.allocatedBytes.load(std::memory_order_relaxed));
+				int64_t allocations = static_cast<int64_t>(tag.allocations.load(std::memory_order_relaxed));
+				snapshot.tags[i].allocatedBytes += allocatedBytes;
+				snapshot.tags[i].allocations += allocations;
+				snapshot.tags[i].liveBytes += allocatedBytes - static_cast<int64_t>(tag.freedBytes.load(std::memory_order_relaxed));
+				snapshot.tags[i].liveAllocations += allocations - static_cast<int64_t>(tag.frees.load(std::memory_order_relaxed));
+			}
+		}
+
+		uint32_t count = s_state.callSiteCount.load(std::memory_order_acquire);
+		for (uint32_t i = 1; i < count; i++) {
+			const CallSiteCounters& counters = s_state.callSites[i];
+			int64_t liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+			if (liveAllocations != 0) {
+				const MemoryCallSite& site = counters.site;
+				snapshot.callSites.push_back({ site.file, site.line, site.tag, site.index, counters.liveBytes.load(std::memory_order_relaxed), liveAllocations });
+			}
+		}
+		return snapshot;
+	}
+
+	void MemoryTracker::Log(const MemorySnapshot& snapshot, std::string_view title)
+	{
+		std::string tags;
+		for (size_t i = 0; i < TagCount; i++) {
+			const MemoryTagStats& tag = snapshot.tags[i];
+			if (tag.liveBytes != 0 || tag.liveAllocations != 0) {
+				tags += std::format(", {} {} bytes in {} allocations", GetTagName(static_cast<MemoryTag>(i)), tag.liveBytes, tag.liveAllocations);
+			}
+		}
+		LOG_INFO("Memory {}: {} bytes{}", title, snapshot.GetLiveBytes(), tags);
+
+		constexpr size_t LoggedCallSites = 10;
+		for (size_t i = 0; i < (std::min)(snapshot.callSites.size(), LoggedCallSites); i++) {
+			const MemoryCallSiteStats& site = snapshot.callSites[i];
+			LOG_INFO("    {}:{} [{}] {} bytes in {} allocations", site.file, site.line, GetTagName(site.tag), site.liveBytes, site.liveAllocations);
+		}
+	}
+} // namespace IneptEngine::Core
+
+#ifdef INEPT_ENABLE_MEMORY_TRACKING
+using IneptEngine::Core::MemoryTracker;
+using IneptEngine::Core::MemoryCallSite;
+
+void* operator new(size_t size)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, alignof(std::max_align_t), MemoryTracker::GetCurrentTag(), 0);
+}
+
+void* operator new[](size_t size)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, alignof(std::max_align_t), MemoryTracker::GetCurrentTag(), 0);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, static_cast<size_t>(alignment), MemoryTracker::GetCurrentTag(), 0);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, static_cast<size_t>(alignment), MemoryTracker::GetCurrentTag(), 0);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return MemoryTracker::Allocate(size, alignof(std::max_align_t), MemoryTracker::GetCurrentTag());
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return MemoryTracker::Allocate(size, alignof(std::max_align_t), MemoryTracker::GetCurrentTag());
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), MemoryTracker::GetCurrentTag());
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), MemoryTracker::GetCurrentTag());
+}
+
+void* operator new(size_t size, const MemoryCallSite& site)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, alignof(std::max_align_t), site.tag, IneptEngine::Core::GetCapturedCallSite(site));
+}
+
+void* operator new[](size_t size, const MemoryCallSite& site)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, alignof(std::max_align_t), site.tag, IneptEngine::Core::GetCapturedCallSite(site));
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const MemoryCallSite& site)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, static_cast<size_t>(alignment), site.tag, IneptEngine::Core::GetCapturedCallSite(site));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const MemoryCallSite& site)
+{
+	return IneptEngine::Core::AllocateOrThrow(size, static_cast<size_t>(alignment), site.tag, IneptEngine::Core::GetCapturedCallSite(site));
+}
+
+void operator delete(void* memory) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, size_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, size_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, const MemoryCallSite&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, const MemoryCallSite&) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t, const MemoryCallSite&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t, const MemoryCallSite&) noexcept { MemoryTracker::Free(memory); }
+#endif
@@ -0,0 +1,212 @@
+#include <Core/Profiler.h>
+#include <Core/MemoryTracker.h>
+#include <Core/ThreadNodeList.h>
+
+#include <Logging/Log.h>
+
+namespace IneptEngine::Core {
+
+	namespace {
+		struct ZoneRecord {
+			const char* name;
+			Clock::Ticks start;
+			Clock::Ticks end;
+		};
+
+		// The zones of one thread, written only by that thread and read once a capture is done
+		struct ThreadBuffer {
+			std::unique_ptr<ZoneRecord[]> zones;
+			std::atomic<size_t> count = 0;
+			std::atomic<size_t> droppedCount = 0;
+
+			// The capture the zones belong to, the owning thread empties the buffer when a new capture starts
+			std::atomic<uint64_t> capture = 0;
+
+			std::string name;
+		};
+
+		struct ProfilerState {
+			std::mutex mutex;
+			ThreadNodeList<ThreadBuffer> buffers;
+
+			std::atomic<bool> captureRequested = false;
+			uint32_t requestedFrames = 0;
+			std::string requestedPath;
+
+			uint32_t frameCount = 0;
+			uint32_t remainingFrames = 0;
+			std::string path;
+			Clock::Ticks captureStart = 0;
+
+			~ProfilerState() {
+				buffers.DeleteNodes();
+			}
+		};
+
+		ProfilerState& GetState()
+		{
+			static ProfilerState state;
+			return state;
+		}
+
+		// Hands the buffer back when the thread exits, a thread started later reuses it
+		thread_local ThreadNodeHandle<ThreadBuffer> t_threadBuffer;
+
+		ThreadBuffer* GetThreadBuffer()
+		{
+			if (t_threadBuffer.Get() != nullptr) {
+				return &t_threadBuffer.Get()->value;
+			}
+
+			MEMORY_TAG_SCOPE(Profiler);
+			ProfilerState& state = GetState();
+			ThreadNodeList<ThreadBuffer>::Node* node = state.buffers.Acquire();
+			{
+				// A reused buffer still has the name of the thread that exited
+				std::lock_guard<std::mutex> lock(state.mutex);
+				node->value.name.clear();
+			}
+			t_threadBuffer.Set(node);
+			return &node->value;
+		}
+
+		void AppendJsonString(std::string& json, std::string_view text)
+		{
+			json += '"';
+			for (char c : text) {
+				if (c == '"' || c == '\\') {
+					json += '\\';
+				}
+				json += c;
+			}
+			json += '"';
+		}
+
+		/**
+		 * @brief Writes the zones of the finished capture in the Chrome trace event format, with the state locked
+		 */
+		void WriteCapture(ProfilerState& state)
+		{
+			MEMORY_TAG_SCOPE(Profiler);
+			uint64_t capture = Profiler::GetCapture();
+			std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+			size_t zoneCount = 0;
+			size_t droppedCount = 0;
+			bool first = true;
+
+			for (auto* node = state.buffers.GetFirst(); node != nullptr; node = node->next) {
+				ThreadBuffer* buffer = &node->value;
+				if (buffer->capture.load(std::memory_order_acquire) != capture) {
+					continue;
+				}
+
+				// Thread ids start at one, in the order the threads first recorded a zone
+				uint32_t threadId = node->id + 1;
+				size_t count = buffer->count.load(std::memory_order_acquire);
+				droppedCount += buffer->droppedCount.load(std::memory_order_relaxed);
+
+				std::string name = buffer->name.empty() ? std::format("Thread {}", threadId) : buffer->name;
+				json += first ? "" : ",\n";
+				json += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":", threadId);
+				AppendJsonString(json, name);
+				json += "}}";
+				first = false;
+
+				for (size_t i = 0; i < count; i++) {
+					const ZoneRecord& zone = buffer->zones[i];
+					json += ",\n{\"name\":";
+					AppendJsonString(json, zone.name);
+					json += std::format(",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+						Clock::ElapsedNanoseconds(state.captureStart, zone.start) / 1000.0, Clock::ElapsedNanoseconds(zone.start, zone.end) / 1000.0, threadId);
+				}
+				zoneCount += count;
+			}
+			json += "\n]}\n";
+
+			std::ofstream file(state.path, std::ios::binary);
+			if (!file) {
+				LOG_ERROR("Could not write profile capture {}", state.path);
+				return;
+			}
+			file << json;
+			LOG_INFO("Profiler wrote {} zones of {} frames to {}", zoneCount, state.frameCount, state.path);
+			if (droppedCount != 0) {
+				LOG_WARNING("Profiler dropped {} zones, more than {} on a thread", droppedCount, Profiler::ZonesPerThread);
+			}
+		}
+	}
+
+	void Profiler::CaptureFrames(uint32_t frameCount, const std::string& path)
+	{
+#ifndef INEPT_ENABLE_PROFILER
+		LOG_WARNING("The profiler zones are compiled out, build with INEPT_ENABLE_PROFILER to capture them");
+#endif
+		ProfilerState& state = GetState();
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.requestedFrames = (std::max)(frameCount, uint32_t(1));
+		state.requestedPath = path;
+		state.captureRequested.store(true, std::memory_order_relaxed);
+	}
+
+	void Profiler::BeginFrame()
+	{
+		ProfilerState& state = GetState();
+		if (!IsCapturing() && !state.captureRequested.load(std::memory_order_relaxed)) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (IsCapturing()) {
+			if (--state.remainingFrames != 0) {
+				return;
+			}
+			s_capturing.store(false, std::memory_order_relaxed);
+			WriteCapture(state);
+		}
+
+		if (state.captureRequested.exchange(false, std::memory_order_relaxed)) {
+			state.path = std::move(state.requestedPath);
+			state.frameCount = state.requestedFrames;
+			state.remainingFrames = state.requestedFrames;
+			// Zones that read the new capture id started after captureStart
+			state.captureStart = Clock::Now();
+			s_capture.fetch_add(1, std::memory_order_release);
+			s_capturing.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	void Profiler::SetThreadName(const std::string& name)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(GetState().mutex);
+		buffer->name = name;
+	}
+
+	void Profiler::RecordZone(const char* name, Clock::Ticks start, Clock::Ticks end, uint64_t capture)
+	{
+		// A zone still open when its capture ended is dropped, it would start before the next capture
+		if (!IsCapturing() || capture != s_capture.load(std::memory_order_relaxed)) {
+			return;
+		}
+
+		ThreadBuffer* buffer = GetThreadBuffer();
+		if (buffer->zones == nullptr) {
+			MEMORY_TAG_SCOPE(Profiler);
+			buffer->zones = std::make_unique_for_overwrite<ZoneRecord[]>(ZonesPerThread);
+		}
+
+		if (buffer->capture.load(std::memory_order_relaxed) != capture) {
+			buffer->count.store(0, std::memory_order_relaxed);
+			buffer->droppedCount.store(0, std::memory_order_relaxed);
+			buffer->capture.store(capture, std::memory_order_release);
+		}
+
+		size_t index = buffer->count.load(std::memory_order_relaxed);
+		if (index >= ZonesPerThread) {
+			buffer->droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		buffer->zones[index] = { name, start, end };
+		buffer->count.store(index + 1, std::memory_order_release);
+	}
+} // namespace IneptEngine::Core
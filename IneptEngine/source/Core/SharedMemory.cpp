@@ -0,0 +1,150 @@
+#include <Core/SharedMemory.h>
+
+#ifndef INEPT_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace IneptEngine::Core {
+#ifdef INEPT_PLATFORM_WINDOWS
+	std::string SharedMemory::GetSystemName(const std::string& name)
+	{
+		return "Local\\IneptEngine." + name;
+	}
+
+	bool SharedMemory::Create(const std::string& name, size_t size)
+	{
+		Close();
+		m_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>(static_cast<uint64_t>(size) >> 32), static_cast<DWORD>(size), GetSystemName(name).c_str());
+		if (m_mapping == nullptr) {
+			return false;
+		}
+
+		// A mapping still held by another process is reused as it is, clear it like a new one
+		bool existed = GetLastError() == ERROR_ALREADY_EXISTS;
+		m_data = static_cast<std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+		if (m_data == nullptr) {
+			Close();
+			return false;
+		}
+		if (existed) {
+			std::memset(m_data, 0, size);
+		}
+		m_size = size;
+		m_name = name;
+		m_owner = true;
+		return true;
+	}
+
+	bool SharedMemory::Open(const std::string& name, size_t size)
+	{
+		Close();
+		m_mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, GetSystemName(name).c_str());
+		if (m_mapping == nullptr) {
+			return false;
+		}
+
+		m_data = static_cast<std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+		if (m_data == nullptr) {
+			Close();
+			return false;
+		}
+		m_size = size;
+		m_name = name;
+		return true;
+	}
+
+	void SharedMemory::Close()
+	{
+		// The mapping is destroyed by Windows once no process holds it any more
+		if (m_data != nullptr) {
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+		if (m_mapping != nullptr) {
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+		m_size = 0;
+		m_name.clear();
+		m_owner = false;
+	}
+#else
+	std::string SharedMemory::GetSystemName(const std::string& name)
+	{
+		return "/IneptEngine." + name;
+	}
+
+	bool SharedMemory::Create(const std::string& name, size_t size)
+	{
+		Close();
+		std::string systemName = GetSystemName(name);
+
+		// A block left behind by a process that crashed is removed, processes still mapping it keep their copy
+		shm_unlink(systemName.c_str());
+		int file = shm_open(systemName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (file < 0) {
+			return false;
+		}
+		if (ftruncate(file, static_cast<off_t>(size)) != 0) {
+			close(file);
+			shm_unlink(systemName.c_str());
+			return false;
+		}
+
+		void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		close(file);
+		if (data == MAP_FAILED) {
+			shm_unlink(systemName.c_str());
+			return false;
+		}
+		m_data = static_cast<std::byte*>(data);
+		m_size = size;
+		m_name = name;
+		m_owner = true;
+		return true;
+	}
+
+	bool SharedMemory::Open(const std::string& name, size_t size)
+	{
+		Close();
+		int file = shm_open(GetSystemName(name).c_str(), O_RDWR, 0600);
+		if (file < 0) {
+			return false;
+		}
+
+		struct stat status;
+		if (fstat(file, &status) != 0 || static_cast<size_t>(status.st_size) < size) {
+			close(file);
+			return false;
+		}
+
+		void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		close(file);
+		if (data == MAP_FAILED) {
+			return false;
+		}
+		m_data = static_cast<std::byte*>(data);
+		m_size = size;
+		m_name = name;
+		return true;
+	}
+
+	void SharedMemory::Close()
+	{
+		if (m_data != nullptr) {
+			munmap(m_data, m_size);
+			m_data = nullptr;
+		}
+		if (m_owner) {
+			shm_unlink(GetSystemName(m_name).c_str());
+		}
+		m_size = 0;
+		m_name.clear();
+		m_owner = false;
+	}
+#endif
+} // namespace IneptEngine::Core
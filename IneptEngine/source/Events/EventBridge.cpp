@@ -0,0 +1,47 @@
+#include <Events/EventBus.h>
+#include <Events/EventBridge.h>
+
+namespace IneptEngine::Events {
+
+    namespace {
+        // The bridge publishing received events on this thread, whose handler must not send them back
+        thread_local const EventBridge* t_pollingBridge = nullptr;
+    }
+
+    EventBridge::EventBridge(EventChannel& channel, EventCategory categories) : m_channel(channel)
+    {
+        m_subscription = EventBus::GetInstance().Subscribe(categories, [this](Event* event) {
+            Forward(*event);
+            });
+    }
+
+    void EventBridge::Forward(Event& event)
+    {
+        if (t_pollingBridge == this) {
+            return;
+        }
+        if (m_channel.Send(event)) {
+            m_sentCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t EventBridge::Poll()
+    {
+        EventBus& bus = EventBus::GetInstance();
+        t_pollingBridge = this;
+
+        // Bounded by the ring size, so a process that keeps sending cannot hold this frame forever
+        size_t received = 0;
+        EventVariant event;
+        while (received < EventChannel::Capacity && m_channel.Receive(event)) {
+            std::visit([&bus](auto& concreteEvent) {
+                bus.PublishNow<std::decay_t<decltype(concreteEvent)>>(std::move(concreteEvent));
+                }, event);
+            received++;
+        }
+
+        t_pollingBridge = nullptr;
+        m_receivedCount += received;
+        return received;
+    }
+} //namespace IneptEngine::Events
@@ -1,85 +1,1029 @@
 #include <Events/EventBus.h>
 
 #include <Logging/Log.h>
+#include <Core/Profiler.h>
 
 namespace IneptEngine::Events {
+    namespace {
+        // The subscriptions whose handler the calling thread is inside of, innermost last
+        thread_local std::vector<const void*> t_callingSlots;
+    }
+
+    EventBus::EventBus()
+    {
+        SetCoalescingPolicy<WindowResizeEvent>(CoalescingPolicy::KeepLatest);
+        SetCoalescingPolicy<WindowMovedEvent>(CoalescingPolicy::KeepLatest);
+        SetCoalescingPolicy<MouseMovedEvent>(CoalescingPolicy::KeepLatest);
+        SetCoalescingPolicy<MouseScrolledEvent>([](MouseScrolledEvent& pending, const MouseScrolledEvent& incoming) {
+            pending = MouseScrolledEvent(pending.GetXOffset() + incoming.GetXOffset(), pending.GetYOffset() + incoming.GetYOffset());
+            });
+    }
+
+    EventBus::~EventBus()
+    {
+        delete m_snapshot.load(std::memory_order_relaxed);
+        m_publishShards.DeleteNodes();
+    }
+
+    void EventDeleter::operator()(Event* event) const
+    {
+        EventBus::GetInstance().DestroyEvent(event);
+    }
+
+    void EventBus::DestroyEvent(Event* event)
+    {
+        for (EventArena& arena : m_arenas) {
+            if (arena.Owns(event)) {
+                event->~Event();
+                arena.Release();
+                return;
+            }
+        }
+        delete event;
+    }
+
+    SubscriptionToken EventBus::Subscribe(EventType type, EventHandler handler, const void* owner)
+    {
+        return AddSubscription(type, EventCategory::None, InlineEventHandler([handler = std::move(handler)](Event& event) {
+            handler(&event);
+            }), owner, SubscriptionFlags::None);
+    }
+
+    SubscriptionToken EventBus::Subscribe(EventCategory category, EventHandler handler, const void* owner)
+    {
+        return AddSubscription(EventType::None, category, InlineEventHandler([handler = std::move(handler)](Event& event) {
+            handler(&event);
+            }), owner, SubscriptionFlags::None);
+    }
 
-    Subscription& EventBus::Subscribe(EventType type, EventHandler handler)
+    SubscriptionToken EventBus::AddSubscription(EventType type, EventCategory category, InlineEventHandler handler, const void* owner, SubscriptionFlags flags)
     {
+        MEMORY_TAG_SCOPE(Events);
         std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        Subscription* subscription = new Subscription(type, EventCategory::None, handler);
-        m_subscriptions.emplace_back(subscription);
-        return *subscription;
+        if (owner != nullptr && !m_ownedSlots.try_emplace({ owner, type, category }, UINT32_MAX).second) {
+            return SubscriptionToken();
+        }
+
+        uint32_t index;
+        if (!m_freeSlots.empty()) {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back().index = index;
+        }
+
+        SubscriptionSlot& slot = m_slots[index];
+        slot.active.store(true, std::memory_order_relaxed);
+        slot.flags = flags;
+        slot.type = type;
+        slot.category = category;
+        slot.owner = owner;
+        slot.handler = std::move(handler);
+        slot.callCount.store(0, std::memory_order_relaxed);
+        slot.totalNanoseconds.store(0, std::memory_order_relaxed);
+        slot.maxNanoseconds.store(0, std::memory_order_relaxed);
+        if (owner != nullptr) {
+            m_ownedSlots[{ owner, type, category }] = index;
+        }
+        m_subscriberCount++;
+
+        // The handler fires from the next dispatched event, even if the subscription was made by a handler during dispatch
+        PublishSnapshot(&slot);
+        ReclaimSlots();
+        return SubscriptionToken({ index, slot.generation });
+    }
+
+    bool EventBus::IsSubscribed(SubscriptionHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+        return handle.index < m_slots.size() && m_slots[handle.index].active.load(std::memory_order_relaxed) && m_slots[handle.index].generation == handle.generation;
     }
 
-    Subscription& EventBus::Subscribe(EventCategory category, EventHandler handler)
+    bool EventBus::IsSubscribed(const void* owner, EventType type)
     {
         std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        Subscription* subscription = new Subscription(EventType::None, category, handler);
-        m_subscriptions.emplace_back(subscription);
-        return *subscription;
+        return m_ownedSlots.contains({ owner, type, EventCategory::None });
     }
 
-    bool EventBus::IsSubscribed(EventType type, EventHandler handler)
+    bool EventBus::IsSubscribed(const void* owner, EventCategory category)
     {
         std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        for (const auto& subscription : m_subscriptions) {
-            if (subscription->type == type && subscription->handler.target<EventHandler>() == handler.target<EventHandler>()) {
-                return true;
+        return m_ownedSlots.contains({ owner, EventType::None, category });
+    }
+
+    void EventBus::Unsubscribe(SubscriptionHandle handle)
+    {
+        SubscriptionSlot* slot;
+        {
+            std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+            if (handle.index >= m_slots.size()) {
+                return;
             }
+
+            slot = &m_slots[handle.index];
+            if (!slot->active.load(std::memory_order_relaxed) || slot->generation != handle.generation) {
+                return;
+            }
+
+            // The slot stays in the subscriber snapshot, dispatch skips it until ReclaimSlots publishes a snapshot without it
+            slot->active.store(false, std::memory_order_seq_cst);
+            slot->generation++;
+            if (slot->owner != nullptr) {
+                m_ownedSlots.erase({ slot->owner, slot->type, slot->category });
+            }
+            m_unsubscribedSlots.push_back(handle.index);
+            m_subscriberCount--;
+        }
+
+        // Calls already running on other threads finish before the caller may destroy what the handler uses,
+        // the calls this thread is inside of finish after it returns
+        uint32_t ownCalls = static_cast<uint32_t>(std::count(t_callingSlots.begin(), t_callingSlots.end(), slot));
+        while (slot->runningCalls.load(std::memory_order_acquire) > ownCalls) {
+            std::this_thread::yield();
         }
-        return false;
     }
 
-    void EventBus::Unsubscribe(const Subscription& subscription)
+    size_t EventBus::GetSubscriberCount()
     {
         std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        auto it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(), [&subscription](const auto& s) {
-            return *s == subscription;
-            });
-        if (it != m_subscriptions.end()) {
-            m_subscriptions.erase(it);
+        return m_subscriberCount;
+    }
+
+    void EventBus::PublishSnapshot(SubscriptionSlot* added)
+    {
+        // A subscription belongs to the list of its type, or to the list of every category bitmask it intersects with
+        auto isListed = [](const SubscriptionSlot& slot, size_t list) {
+            if ((list >= ConcurrentLists) != (slot.flags == SubscriptionFlags::Concurrent)) {
+                return false;
+            }
+            size_t setList = list % ListsPerSet;
+            if (setList < EventTypeCount) {
+                return slot.type != EventType::None && static_cast<size_t>(slot.type) == setList;
+            }
+            return slot.type == EventType::None && ((setList - EventTypeCount) & static_cast<size_t>(slot.category)) != 0;
+        };
+
+        const SubscriberSnapshot* current = m_snapshot.load(std::memory_order_relaxed);
+        auto snapshot = std::make_unique<SubscriberSnapshot>();
+        snapshot->slots.reserve(current->slots.size() + (added != nullptr ? CategoryMaskCount : 0));
+        for (size_t list = 0; list < SubscriberListCount; list++) {
+            snapshot->offsets[list] = static_cast<uint32_t>(snapshot->slots.size());
+            for (SubscriptionSlot* slot : current->GetList(list)) {
+                if (slot->active.load(std::memory_order_relaxed)) {
+                    snapshot->slots.push_back(slot);
+                }
+            }
+            if (added != nullptr && isListed(*added, list)) {
+                snapshot->slots.push_back(added);
+            }
         }
+        snapshot->offsets[SubscriberListCount] = static_cast<uint32_t>(snapshot->slots.size());
+        snapshot->slotCount = m_slots.size();
+
+        m_snapshot.store(snapshot.release(), std::memory_order_release);
+        m_retiredSnapshots.push_back({ m_epochs.Retire(), std::unique_ptr<const SubscriberSnapshot>(current), std::move(m_unsubscribedSlots) });
+        m_unsubscribedSlots.clear();
+    }
+
+    void EventBus::ReclaimSlots()
+    {
+        if (!m_unsubscribedSlots.empty()) {
+            PublishSnapshot(nullptr);
+        }
+
+        // Snapshots are retired in epoch order, so the first one that may still be read ends the reclaimable ones
+        size_t reclaimed = 0;
+        while (reclaimed < m_retiredSnapshots.size() && m_epochs.IsSafe(m_retiredSnapshots[reclaimed].epoch)) {
+            for (uint32_t index : m_retiredSnapshots[reclaimed].slots) {
+                SubscriptionSlot& slot = m_slots[index];
+                slot.handler = InlineEventHandler();
+                slot.owner = nullptr;
+                slot.name.clear();
+                m_freeSlots.push_back(index);
+            }
+            reclaimed++;
+        }
+        m_retiredSnapshots.erase(m_retiredSnapshots.begin(), m_retiredSnapshots.begin() + reclaimed);
     }
 
     void EventBus::Publish(EventPtr event)
     {
-        std::lock_guard<std::mutex> lock(m_eventsMutex);
-        m_events.emplace_back(std::move(event));
+        if (IsJournaling() && !JournalQueued(*event)) {
+            return;
+        }
+        EnqueueEvent(std::move(event));
+    }
+
+    void EventBus::Publish(EventVariant event)
+    {
+        if (IsJournaling() && !JournalQueued(*GetEvent(event))) {
+            return;
+        }
+        EnqueueEvent(std::move(event));
+    }
+
+    void EventBus::EnqueueEvent(EventPtr event)
+    {
+        MEMORY_TAG_SCOPE(Events);
+        size_t type = static_cast<size_t>(event->GetType());
+        if (IsCoalesced(type) && Coalesce(type, *event, event.get())) {
+            return;
+        }
+
+        PublishShard& shard = GetPublishShard();
+        ShardedEvent<EventPtr> shardedEvent{ shard.nextSequence++, std::move(event) };
+        if (!shard.events.TryPush(std::move(shardedEvent))) {
+            // The ring is full, keep the event in the overflow list so it is still delivered this frame
+            m_queueOverflowCount.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(shard.overflowMutex);
+            shard.overflowEvents.emplace_back(std::move(shardedEvent));
+            shard.overflowPending.store(true, std::memory_order_release);
+            return;
+        }
+        RecordQueueDepth(shard.events.Size());
+    }
+
+    void EventBus::EnqueueEvent(EventVariant event)
+    {
+        MEMORY_TAG_SCOPE(Events);
+        if (IsCoalesced(event.index() + 1)) {
+            std::visit([this](auto& concreteEvent) {
+                EnqueueEvent(MakeEvent<std::decay_t<decltype(concreteEvent)>>(std::move(concreteEvent)));
+                }, event);
+            return;
+        }
+
+        PublishShard& shard = GetPublishShard();
+        ShardedEvent<EventVariant> shardedEvent{ shard.nextSequence++, std::move(event) };
+        if (!shard.eventValues.TryPush(std::move(shardedEvent))) {
+            m_queueOverflowCount.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(shard.overflowMutex);
+            shard.overflowEventValues.emplace_back(std::move(shardedEvent));
+            shard.overflowPending.store(true, std::memory_order_release);
+            return;
+        }
+        RecordQueueDepth(shard.eventValues.Size());
+    }
+
+    EventBus::PublishShard& EventBus::GetPublishShard()
+    {
+        // The shard is handed back when the thread exits, the events left in it are still dispatched
+        static thread_local Core::ThreadNodeHandle<PublishShard> threadShard;
+        if (threadShard.Get() == nullptr) {
+            threadShard.Set(m_publishShards.Acquire());
+        }
+        return threadShard.Get()->value;
+    }
+
+    void EventBus::DrainPublishShards()
+    {
+        // Events fired by timers are already stored and are keyed to come first, in the order they fired
+        for (size_t i = 0; i < m_processingEventValues.size(); i++) {
+            m_mergedEvents.push_back({ 0, 0, i, static_cast<uint32_t>(i), true });
+        }
+
+        // Events stay where their storage mode keeps them, only their keys are merged into one list
+        auto drainEvent = [this](uint32_t shard, ShardedEvent<EventPtr>& event) {
+            Core::Clock::Ticks timestamp = event.event->GetTimestamp();
+            m_mergedEvents.push_back({ timestamp, shard, event.sequence, static_cast<uint32_t>(m_processingEvents.size()), false });
+            m_processingEvents.emplace_back(std::move(event.event));
+        };
+        auto drainEventValue = [this](uint32_t shard, ShardedEvent<EventVariant>& eventValue) {
+            Core::Clock::Ticks timestamp = GetEvent(eventValue.event)->GetTimestamp();
+            m_mergedEvents.push_back({ timestamp, shard, eventValue.sequence, static_cast<uint32_t>(m_processingEventValues.size()), true });
+            m_processingEventValues.emplace_back(std::move(eventValue.event));
+        };
+
+        // Shards are numbered in the order threads first published in, the number breaks ties between equal timestamps
+        for (auto* node = m_publishShards.GetFirst(); node != nullptr; node = node->next) {
+            PublishShard& shard = node->value;
+
+            // Only events published before draining started are handled, events published by handlers wait for the next call
+            ShardedEvent<EventPtr> event;
+            for (size_t i = 0; i < EventQueueCapacity && shard.events.TryPop(event); i++) {
+                drainEvent(node->id, event);
+            }
+
+            ShardedEvent<EventVariant> eventValue;
+            for (size_t i = 0; i < EventQueueCapacity && shard.eventValues.TryPop(eventValue); i++) {
+                drainEventValue(node->id, eventValue);
+            }
+
+            if (shard.overflowPending.exchange(false, std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(shard.overflowMutex);
+                for (auto& overflowEvent : shard.overflowEvents) {
+                    drainEvent(node->id, overflowEvent);
+                }
+                shard.overflowEvents.clear();
+                for (auto& overflowEventValue : shard.overflowEventValues) {
+                    drainEventValue(node->id, overflowEventValue);
+                }
+                shard.overflowEventValues.clear();
+            }
+        }
+
+        // Sorting is only needed if several threads published, a thread mixed storage modes or published events out of
+        // timestamp order, or a shard overflowed
+        auto byKey = [](const MergedEvent& a, const MergedEvent& b) {
+            return std::tie(a.timestamp, a.shard, a.sequence) < std::tie(b.timestamp, b.shard, b.sequence);
+        };
+        if (!std::is_sorted(m_mergedEvents.begin(), m_mergedEvents.end(), byKey)) {
+            std::sort(m_mergedEvents.begin(), m_mergedEvents.end(), byKey);
+        }
+    }
+
+    void EventBus::SetCoalescingPolicy(EventType type, CoalescingPolicy policy, EventMerger merger)
+    {
+        if (policy != CoalescingPolicy::KeepAll && !merger) {
+            LOG_ERROR("Coalescing policy of {} needs a merge function", Event::TypeToString(type));
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_coalescingMutex);
+        CoalescedEvent& coalescedEvent = m_coalescedEvents[static_cast<size_t>(type)];
+        coalescedEvent.policy = policy;
+        coalescedEvent.merger = std::move(merger);
+        coalescedEvent.pending = nullptr;
+        m_coalescingPolicies[static_cast<size_t>(type)].store(policy, std::memory_order_relaxed);
+    }
+
+    CoalescingPolicy EventBus::GetCoalescingPolicy(EventType type) const
+    {
+        return m_coalescingPolicies[static_cast<size_t>(type)].load(std::memory_order_relaxed);
+    }
+
+    bool EventBus::Coalesce(size_t type, const Event& event, Event* queued)
+    {
+        std::lock_guard<std::mutex> lock(m_coalescingMutex);
+        CoalescedEvent& coalescedEvent = m_coalescedEvents[type];
+        if (coalescedEvent.policy == CoalescingPolicy::KeepAll) {
+            return false;
+        }
+
+        // The queued event is only dispatched after ClearCoalescedEvents, so it can safely be written to here
+        if (coalescedEvent.pending != nullptr) {
+            coalescedEvent.merger(*coalescedEvent.pending, event);
+            m_mergedCounts[type].fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        if (queued != nullptr) {
+            coalescedEvent.pending = queued;
+        }
+        return false;
+    }
+
+    void EventBus::ClearCoalescedEvents()
+    {
+        std::lock_guard<std::mutex> lock(m_coalescingMutex);
+        for (CoalescedEvent& coalescedEvent : m_coalescedEvents) {
+            coalescedEvent.pending = nullptr;
+        }
+    }
+
+    EventCoalescingStats EventBus::GetCoalescingStats() const
+    {
+        size_t mergedCount = 0;
+        for (const auto& typeMergedCount : m_mergedCounts) {
+            mergedCount += typeMergedCount.load(std::memory_order_relaxed);
+        }
+        return { mergedCount };
+    }
+
+    size_t EventBus::GetMergedCount(EventType type) const
+    {
+        return m_mergedCounts[static_cast<size_t>(type)].load(std::memory_order_relaxed);
+    }
+
+    void EventBus::ResetCoalescingStats()
+    {
+        for (auto& typeMergedCount : m_mergedCounts) {
+            typeMergedCount.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void EventBus::RecordQueueDepth(size_t depth)
+    {
+        size_t highWaterMark = m_queueHighWaterMark.load(std::memory_order_relaxed);
+        while (depth > highWaterMark && !m_queueHighWaterMark.compare_exchange_weak(highWaterMark, depth, std::memory_order_relaxed)) {
+        }
     }
 
     void EventBus::PublishNow(EventPtr event)
     {
-        std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
-        for (const auto& subscription : m_subscriptions) {
-            if ((subscription->type == EventType::None) && ((subscription->category & event->GetCategory()) != EventCategory::None) ||
-                (subscription->type == event->GetType()) && ((subscription->category & event->GetCategory()) == EventCategory::None))
-            {
-                subscription->handler(event.get());
+        Event* dispatchedEvent = IsJournaling() ? JournalImmediate(*event) : event.get();
+        if (dispatchedEvent != nullptr) {
+            DispatchNow(static_cast<size_t>(dispatchedEvent->GetType()), *dispatchedEvent);
+        }
+    }
+
+    TimerHandle EventBus::ScheduleTimer(std::chrono::milliseconds delay, std::chrono::milliseconds period, EventVariant event)
+    {
+        auto now = std::chrono::steady_clock::now();
+        uint64_t dueTick = static_cast<uint64_t>((std::chrono::ceil<std::chrono::milliseconds>(now - m_timerEpoch + delay) / TimerResolution));
+        uint64_t periodTicks = static_cast<uint64_t>(period / TimerResolution);
+
+        std::lock_guard<std::mutex> lock(m_timersMutex);
+        return m_timerWheel.Schedule(dueTick, periodTicks, std::move(event));
+    }
+
+    bool EventBus::CancelTimer(TimerHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_timersMutex);
+        return m_timerWheel.Cancel(handle);
+    }
+
+    bool EventBus::IsTimerPending(TimerHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_timersMutex);
+        return m_timerWheel.IsPending(handle);
+    }
+
+    size_t EventBus::GetPendingTimerCount()
+    {
+        std::lock_guard<std::mutex> lock(m_timersMutex);
+        return m_timerWheel.GetPendingCount();
+    }
+
+    void EventBus::AdvanceTimers()
+    {
+        auto now = std::chrono::steady_clock::now();
+        uint64_t tick = static_cast<uint64_t>((std::chrono::floor<std::chrono::milliseconds>(now - m_timerEpoch) / TimerResolution));
+        size_t firstFired = m_processingEventValues.size();
+        {
+            std::lock_guard<std::mutex> lock(m_timersMutex);
+            m_timerWheel.Advance(tick, m_processingEventValues);
+        }
+
+        // The events were created when they were scheduled, their latency is measured from when they fire
+        Core::Clock::Ticks timestamp = TIME_NOW;
+        for (size_t i = firstFired; i < m_processingEventValues.size(); i++) {
+            GetEvent(m_processingEventValues[i])->SetTimestamp(timestamp);
+        }
+
+        if (IsRecording()) {
+            for (size_t i = firstFired; i < m_processingEventValues.size(); i++) {
+                WriteJournal(EventRecordKind::Timer, *GetEvent(m_processingEventValues[i]));
             }
         }
     }
 
     void EventBus::ProcessEvents()
     {
-        std::vector<EventPtr> events;
+        PROFILE_SCOPE("EventBus::ProcessEvents");
+
+        // Due timers fire as one batch before the event buffers are drained
+        AdvanceTimers();
+
+        if (IsReplaying()) {
+            ReplayFrame();
+        }
+
+        bool hasSubscribers;
         {
-            std::lock_guard<std::mutex> lock(m_eventsMutex);
-            std::lock_guard<std::mutex> lock2(m_subscriptionsMutex);
-            if (m_events.empty() || m_subscriptions.empty()) {
-                return;
+            std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+            ReclaimSlots();
+            hasSubscribers = m_subscriberCount != 0;
+        }
+
+        // New events go to the other arena while this frame's events are dispatched
+        EventArena* drainedArena = m_publishArena.load(std::memory_order_relaxed);
+        m_publishArena.store(drainedArena == &m_arenas[0] ? &m_arenas[1] : &m_arenas[0], std::memory_order_release);
+
+        // Events published from now on are journaled for the next frame
+        if (IsJournaling()) {
+            m_journalFrame.fetch_add(1, std::memory_order_relaxed);
+            if (IsReplaying()) {
+                std::lock_guard<std::mutex> lock(m_journalMutex);
+                ReadReplayFrame();
+            }
+        }
+
+        DrainPublishShards();
+
+        // Events published from now on start a new merged event instead of changing one that is about to be dispatched
+        ClearCoalescedEvents();
+
+        // Without subscribers the frame's events are dropped, so they neither pile up in the shards and the arena nor
+        // reach a subscriber that arrives later, journaling already happened when they were published
+        if (!hasSubscribers) {
+            m_mergedEvents.clear();
+            m_processingEvents.clear();
+            m_processingEventValues.clear();
+            drainedArena->TryReset();
+            return;
+        }
+
+        if (m_statsEnabled.load(std::memory_order_relaxed)) {
+            m_eventsPerFrameHistogram.Record(m_processingEvents.size() + m_processingEventValues.size());
+        }
+
+        // Snapshots read from here on are not freed before the concurrent jobs have finished with them
+        Core::EpochDomain::ReadGuard readGuard(m_epochs);
+
+        // Concurrent subscribers run on the JobSystem while the main thread dispatches to the rest
+        bool dispatchingConcurrently = DispatchConcurrent();
+
+        uint32_t dispatchedCount = 0;
+        for (const MergedEvent& mergedEvent : m_mergedEvents) {
+            if (mergedEvent.isValue) {
+                // Events stored by value are visited in place, the concrete type is known without a virtual call
+                std::visit([this](auto& concreteEvent) {
+                    Dispatch(static_cast<size_t>(EventTypeOf<std::decay_t<decltype(concreteEvent)>>), concreteEvent);
+                    }, m_processingEventValues[mergedEvent.index]);
+            }
+            else {
+                Dispatch(m_processingEvents[mergedEvent.index].get());
+            }
+
+            // Concurrent handlers only read the event once the main-thread handlers can no longer write it
+            if (dispatchingConcurrently) {
+                m_mainDispatchedCount.store(++dispatchedCount, std::memory_order_seq_cst);
+                ScheduleConcurrentBatches();
             }
-            events = std::move(m_events);
         }
 
-        for (const auto& event : events) {
-            for (const auto& subscription : m_subscriptions) {
-                if ((subscription->type == EventType::None) && ((subscription->category & event->GetCategory()) != EventCategory::None) ||
-                    (subscription->type == event->GetType()) && ((subscription->category & event->GetCategory()) == EventCategory::None))
-                {
-                    subscription->handler(event.get());
+        if (dispatchingConcurrently) {
+            Core::JobSystem::GetInstance().Wait(m_concurrentJobs);
+        }
+        m_mergedEvents.clear();
+        m_processingEvents.clear();
+        m_processingEventValues.clear();
+
+        // Events still held elsewhere keep the arena alive until a later frame
+        drainedArena->TryReset();
+
+        if (m_statsDumpInterval.count() != 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - m_lastStatsDump >= m_statsDumpInterval) {
+                DumpStats();
+                m_lastStatsDump = now;
+            }
+        }
+    }
+
+    void EventBus::SetStatsDumpInterval(std::chrono::milliseconds interval)
+    {
+        m_statsDumpInterval = interval;
+        m_lastStatsDump = std::chrono::steady_clock::now();
+        if (interval.count() != 0) {
+            SetStatsEnabled(true);
+        }
+    }
+
+    void EventBus::SetSubscriptionName(SubscriptionHandle handle, std::string name)
+    {
+        std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+        if (handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation) {
+            m_slots[handle.index].name = std::move(name);
+        }
+    }
+
+    EventBusStats EventBus::GetStats()
+    {
+        EventBusStats stats;
+        for (size_t type = 1; type < EventTypeCount; type++) {
+            EventHistogramSnapshot latency = m_latencyHistograms[type].GetSnapshot();
+            EventHistogramSnapshot handlerTime = m_handlerTimeHistograms[type].GetSnapshot();
+            if (latency.count != 0 || handlerTime.count != 0) {
+                stats.types.push_back({ static_cast<EventType>(type), latency, handlerTime });
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+            for (uint32_t index = 0; index < m_slots.size(); index++) {
+                const SubscriptionSlot& slot = m_slots[index];
+                if (slot.active.load(std::memory_order_relaxed)) {
+                    stats.handlers.push_back({
+                        { index, slot.generation }, slot.name, slot.owner, slot.type, slot.category,
+                        slot.callCount.load(std::memory_order_relaxed),
+                        slot.totalNanoseconds.load(std::memory_order_relaxed),
+                        slot.maxNanoseconds.load(std::memory_order_relaxed)
+                        });
+                }
+            }
+        }
+        std::sort(stats.handlers.begin(), stats.handlers.end(), [](const EventHandlerStats& a, const EventHandlerStats& b) {
+            return a.totalNanoseconds > b.totalNanoseconds;
+            });
+
+        stats.eventsPerFrame = m_eventsPerFrameHistogram.GetSnapshot();
+        stats.queue = GetQueueStats();
+        stats.arena = GetArenaStats();
+        stats.coalescing = GetCoalescingStats();
+        return stats;
+    }
+
+    void EventBus::DumpStats()
+    {
+        constexpr size_t maxHandlers = 10;
+
+        EventBusStats stats = GetStats();
+        std::sort(stats.types.begin(), stats.types.end(), [](const EventTypeStats& a, const EventTypeStats& b) {
+            return a.handlerTime.sum > b.handlerTime.sum;
+            });
+
+        std::string report = std::format("EventBus stats: {} frames, {:.1f} events/frame (p99 {}), peak queue depth {}/{}, {} overflowed, {} merged\n",
+            stats.eventsPerFrame.count, stats.eventsPerFrame.GetMean(), stats.eventsPerFrame.p99,
+            stats.queue.highWaterMark, stats.queue.capacity, stats.queue.overflowCount, stats.coalescing.mergedCount);
+
+        report += std::format("  {:<20} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12}\n", "event type", "events", "latency p50", "latency p99", "handler p50", "handler p99", "handler ms");
+        for (const EventTypeStats& type : stats.types) {
+            report += std::format("  {:<20} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12.3f}\n", Event::TypeToString(type.type), type.latency.count,
+                type.latency.p50, type.latency.p99, type.handlerTime.p50, type.handlerTime.p99, type.handlerTime.sum / 1e6);
+        }
+
+        report += std::format("  {:<32} {:>10} {:>12} {:>12} {:>12}\n", "handler", "calls", "mean ns", "max ns", "total ms");
+        for (size_t i = 0; i < stats.handlers.size() && i < maxHandlers; i++) {
+            const EventHandlerStats& handler = stats.handlers[i];
+            std::string name = !handler.name.empty() ? handler.name :
+                handler.type != EventType::None ? std::format("#{} {}", handler.handle.index, Event::TypeToString(handler.type)) :
+                std::format("#{} {}", handler.handle.index, Event::CategoryToString(handler.category));
+            report += std::format("  {:<32} {:>10} {:>12} {:>12} {:>12.3f}\n", name, handler.callCount,
+                handler.callCount != 0 ? handler.totalNanoseconds / handler.callCount : 0, handler.maxNanoseconds, handler.totalNanoseconds / 1e6);
+        }
+        report.pop_back();
+
+        LOG_INFO("{}", report);
+    }
+
+    void EventBus::ResetStats()
+    {
+        for (size_t type = 0; type < EventTypeCount; type++) {
+            m_latencyHistograms[type].Reset();
+            m_handlerTimeHistograms[type].Reset();
+        }
+        m_eventsPerFrameHistogram.Reset();
+
+        {
+            std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+            for (SubscriptionSlot& slot : m_slots) {
+                slot.callCount.store(0, std::memory_order_relaxed);
+                slot.totalNanoseconds.store(0, std::memory_order_relaxed);
+                slot.maxNanoseconds.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        ResetQueueStats();
+        ResetArenaStats();
+        ResetCoalescingStats();
+    }
+
+    bool EventBus::StartRecording(const std::string& path)
+    {
+        StopReplay();
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        if (!m_journalWriter.Open(path)) {
+            LOG_ERROR("Could not create event journal {}", path);
+            return false;
+        }
+        m_journalFrame.store(0, std::memory_order_relaxed);
+        m_journalMode.store(JournalMode::Recording, std::memory_order_relaxed);
+        LOG_INFO("Recording events to {}", path);
+        return true;
+    }
+
+    void EventBus::StopRecording()
+    {
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        if (m_journalWriter.IsOpen()) {
+            LOG_INFO("Recorded {} events over {} frames", m_journalWriter.GetRecordCount(), m_journalFrame.load(std::memory_order_relaxed));
+            m_journalMode.store(JournalMode::None, std::memory_order_relaxed);
+            m_journalWriter.Close();
+        }
+    }
+
+    bool EventBus::StartReplay(const std::string& path)
+    {
+        StopRecording();
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        if (!m_journalReader.Open(path)) {
+            LOG_ERROR("Could not open event journal {}", path);
+            return false;
+        }
+        m_journalFrame.store(0, std::memory_order_relaxed);
+        m_journalMode.store(JournalMode::Replaying, std::memory_order_relaxed);
+        LOG_INFO("Replaying events from {}", path);
+        ReadReplayFrame();
+        return true;
+    }
+
+    void EventBus::StopReplay()
+    {
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        if (m_journalReader.IsOpen()) {
+            m_journalMode.store(JournalMode::None, std::memory_order_relaxed);
+            m_journalReader.Close();
+            m_replayRecords.clear();
+        }
+    }
+
+    bool EventBus::JournalQueued(const Event& event)
+    {
+        if (IsReplaying()) {
+            return false;
+        }
+        WriteJournal(EventRecordKind::Queued, event);
+        return true;
+    }
+
+    Event* EventBus::JournalImmediate(Event& event)
+    {
+        if (!IsReplaying()) {
+            WriteJournal(EventRecordKind::Immediate, event);
+            return &event;
+        }
+
+        // The records are only replaced by ProcessEvents, so the event stays valid while it is dispatched
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        for (; m_replayImmediateIndex < m_replayRecords.size(); m_replayImmediateIndex++) {
+            EventJournalRecord& record = m_replayRecords[m_replayImmediateIndex];
+            if (record.kind == EventRecordKind::Immediate) {
+                m_replayImmediateIndex++;
+                return GetEvent(record.event);
+            }
+        }
+        return nullptr;
+    }
+
+    void EventBus::WriteJournal(EventRecordKind kind, const Event& event)
+    {
+        std::lock_guard<std::mutex> lock(m_journalMutex);
+        if (!m_journalWriter.IsOpen()) {
+            return;
+        }
+        if (!m_journalWriter.Write(m_journalFrame.load(std::memory_order_relaxed), kind, event)) {
+            LOG_ERROR("Event journal could not be grown, recording stopped");
+            m_journalMode.store(JournalMode::None, std::memory_order_relaxed);
+            m_journalWriter.Close();
+        }
+    }
+
+    void EventBus::ReplayFrame()
+    {
+        // Live timers are dropped so only the recorded events drive the frame
+        m_processingEventValues.clear();
+
+        Core::Clock::Ticks timestamp = TIME_NOW;
+        for (size_t i = 0; i < m_replayRecords.size(); i++) {
+            EventJournalRecord& record = m_replayRecords[i];
+            switch (record.kind) {
+            case EventRecordKind::Queued:
+                EnqueueEvent(record.event);
+                break;
+            case EventRecordKind::Immediate:
+                // Events that no PublishNow call took their place in the frame are not lost
+                if (i >= m_replayImmediateIndex) {
+                    Event* event = GetEvent(record.event);
+                    DispatchNow(static_cast<size_t>(event->GetType()), *event);
                 }
+                break;
+            case EventRecordKind::Timer:
+                m_processingEventValues.push_back(record.event);
+                GetEvent(m_processingEventValues.back())->SetTimestamp(timestamp);
+                break;
             }
         }
     }
+
+    void EventBus::ReadReplayFrame()
+    {
+        uint32_t frame = m_journalFrame.load(std::memory_order_relaxed);
+        m_replayRecords.clear();
+        m_replayImmediateIndex = 0;
+        m_journalReader.ReadFrame(frame, m_replayRecords);
+        if (m_replayRecords.empty() && m_journalReader.IsFinished()) {
+            LOG_INFO("Event replay finished after {} frames", frame);
+            m_journalMode.store(JournalMode::None, std::memory_order_relaxed);
+            m_journalReader.Close();
+        }
+    }
+
+    bool EventBus::DispatchConcurrent()
+    {
+        const SubscriberSnapshot& snapshot = *m_snapshot.load(std::memory_order_acquire);
+        if (!snapshot.HasConcurrentSubscribers() || m_mergedEvents.empty()) {
+            return false;
+        }
+
+        m_concurrentEvents.clear();
+        for (const MergedEvent& mergedEvent : m_mergedEvents) {
+            m_concurrentEvents.push_back(GetMergedEvent(mergedEvent));
+        }
+
+        // Every concurrent subscriber gets its own batch holding the events it receives in dispatch order
+        m_slotBatches.assign(snapshot.slotCount, UINT32_MAX);
+        size_t batchCount = 0;
+        auto addToBatches = [this, &batchCount](std::span<SubscriptionSlot* const> subscriptions, Event* event, uint32_t position) {
+            for (SubscriptionSlot* slot : subscriptions) {
+                if (!slot->active.load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                if (m_slotBatches[slot->index] == UINT32_MAX) {
+                    m_slotBatches[slot->index] = static_cast<uint32_t>(batchCount);
+                    if (batchCount == m_concurrentBatches.size()) {
+                        m_concurrentBatches.emplace_back();
+                    }
+                    ConcurrentBatch& batch = m_concurrentBatches[batchCount];
+                    batch.slot = slot;
+                    batch.events.clear();
+                    batch.handledCount.store(0, std::memory_order_relaxed);
+                    batch.scheduled.store(false, std::memory_order_relaxed);
+                    batchCount++;
+                }
+                m_concurrentBatches[m_slotBatches[slot->index]].events.emplace_back(event, position);
+            }
+        };
+
+        for (uint32_t position = 0; position < m_concurrentEvents.size(); position++) {
+            Event* event = m_concurrentEvents[position];
+            size_t type = static_cast<size_t>(event->GetType());
+            if (type < EventTypeCount) {
+                addToBatches(snapshot.GetList(ConcurrentLists + type), event, position);
+            }
+            addToBatches(snapshot.GetList(ConcurrentLists + EventTypeCount + (static_cast<size_t>(event->GetCategory()) & (CategoryMaskCount - 1))), event, position);
+        }
+
+        m_concurrentBatchCount = batchCount;
+        m_mainDispatchedCount.store(0, std::memory_order_relaxed);
+        return batchCount != 0;
+    }
+
+    void EventBus::ScheduleConcurrentBatches()
+    {
+        uint32_t dispatchedCount = m_mainDispatchedCount.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < m_concurrentBatchCount; i++) {
+            // A stale handled count only submits a job that finds nothing to do
+            ConcurrentBatch* batch = &m_concurrentBatches[i];
+            uint32_t handledCount = batch->handledCount.load(std::memory_order_relaxed);
+            if (handledCount == batch->events.size() || batch->events[handledCount].second >= dispatchedCount) {
+                continue;
+            }
+
+            // A batch runs on one worker at a time, so each subscriber sees its events one after another and in order
+            if (!batch->scheduled.exchange(true, std::memory_order_seq_cst)) {
+                Core::JobSystem::GetInstance().Submit([this, batch]() { RunConcurrentBatch(*batch); }, &m_concurrentJobs);
+            }
+        }
+    }
+
+    void EventBus::RunConcurrentBatch(ConcurrentBatch& batch)
+    {
+        uint32_t handledCount = batch.handledCount.load(std::memory_order_relaxed);
+        while (true) {
+            uint32_t dispatchedCount = m_mainDispatchedCount.load(std::memory_order_seq_cst);
+            while (handledCount < batch.events.size() && batch.events[handledCount].second < dispatchedCount) {
+                Event* event = batch.events[handledCount].first;
+                CallHandler(*batch.slot, static_cast<size_t>(event->GetType()), *event);
+                batch.handledCount.store(++handledCount, std::memory_order_relaxed);
+            }
+
+            // Either this job sees the events the main thread finished meanwhile, or the main thread sees the batch unscheduled
+            batch.scheduled.store(false, std::memory_order_seq_cst);
+            dispatchedCount = m_mainDispatchedCount.load(std::memory_order_seq_cst);
+            if (handledCount == batch.events.size() || batch.events[handledCount].second >= dispatchedCount
+                || batch.scheduled.exchange(true, std::memory_order_seq_cst)) {
+                return;
+            }
+        }
+    }
+
+    EventQueueStats EventBus::GetQueueStats() const
+    {
+        return {
+            EventQueueCapacity,
+            m_queueHighWaterMark.load(std::memory_order_relaxed),
+            m_queueOverflowCount.load(std::memory_order_relaxed)
+        };
+    }
+
+    EventArenaStats EventBus::GetArenaStats() const
+    {
+        return {
+            EventArenaCapacity,
+            (std::max)(m_arenas[0].GetHighWaterMark(), m_arenas[1].GetHighWaterMark()),
+            m_arenaHeapFallbackCount.load(std::memory_order_relaxed)
+        };
+    }
+
+    void EventBus::ResetArenaStats()
+    {
+        for (EventArena& arena : m_arenas) {
+            arena.ResetHighWaterMark();
+        }
+        m_arenaHeapFallbackCount.store(0, std::memory_order_relaxed);
+    }
+
+    void EventBus::ResetQueueStats()
+    {
+        m_queueHighWaterMark.store(0, std::memory_order_relaxed);
+        m_queueOverflowCount.store(0, std::memory_order_relaxed);
+    }
+
+    void EventBus::Dispatch(Event* event)
+    {
+        Dispatch(static_cast<size_t>(event->GetType()), *event);
+    }
+
+    void EventBus::Dispatch(size_t type, Event& event)
+    {
+        if (type < EventTypeCount && m_statsEnabled.load(std::memory_order_relaxed)) {
+            m_latencyHistograms[type].Record(Core::Clock::ElapsedNanoseconds(event.GetTimestamp(), Core::Clock::Now()));
+        }
+        CallHandlers(*m_snapshot.load(std::memory_order_acquire), MainThreadLists, type, event);
+    }
+
+    void EventBus::DispatchNow(size_t type, Event& event)
+    {
+        Core::EpochDomain::ReadGuard readGuard(m_epochs);
+        const SubscriberSnapshot& snapshot = *m_snapshot.load(std::memory_order_acquire);
+        CallHandlers(snapshot, MainThreadLists, type, event);
+        if (snapshot.HasConcurrentSubscribers()) {
+            CallHandlers(snapshot, ConcurrentLists, type, event);
+        }
+    }
+
+    void EventBus::CallHandlers(const SubscriberSnapshot& snapshot, size_t listSet, size_t type, Event& event)
+    {
+        // When timing, one clock read ends a handler call and starts the next one
+        bool timed = m_statsEnabled.load(std::memory_order_relaxed);
+        Core::Clock::Ticks previous = 0;
+        if (timed) {
+            previous = Core::Clock::Now();
+        }
+
+        auto call = [this, type, &event, timed, &previous](SubscriptionSlot& slot) {
+            if (!EnterHandler(slot)) {
+                return;
+            }
+            slot.handler(event);
+            LeaveHandler(slot);
+            if (timed) {
+                Core::Clock::Ticks now = Core::Clock::Now();
+                RecordHandlerTime(slot, type, Core::Clock::ElapsedNanoseconds(previous, now));
+                previous = now;
+            }
+        };
+
+        // The snapshot never changes while it is walked, handlers subscribed during dispatch are in the next snapshot
+        if (type < EventTypeCount) {
+            for (SubscriptionSlot* slot : snapshot.GetList(listSet + type)) {
+                call(*slot);
+            }
+        }
+
+        for (SubscriptionSlot* slot : snapshot.GetList(listSet + EventTypeCount + (static_cast<size_t>(event.GetCategory()) & (CategoryMaskCount - 1)))) {
+            call(*slot);
+        }
+    }
+
+    bool EventBus::EnterHandler(SubscriptionSlot& slot)
+    {
+        // The call is counted before the slot is checked, so Unsubscribe either sees the call or the call sees the slot inactive
+        slot.runningCalls.fetch_add(1, std::memory_order_seq_cst);
+        if (!slot.active.load(std::memory_order_seq_cst)) {
+            slot.runningCalls.fetch_sub(1, std::memory_order_release);
+            return false;
+        }
+        t_callingSlots.push_back(&slot);
+        return true;
+    }
+
+    void EventBus::LeaveHandler(SubscriptionSlot& slot)
+    {
+        t_callingSlots.pop_back();
+        slot.runningCalls.fetch_sub(1, std::memory_order_release);
+    }
+
+    void EventBus::CallHandler(SubscriptionSlot& slot, size_t type, Event& event)
+    {
+        if (!EnterHandler(slot)) {
+            return;
+        }
+        if (!m_statsEnabled.load(std::memory_order_relaxed)) {
+            slot.handler(event);
+            LeaveHandler(slot);
+            return;
+        }
+
+        Core::Clock::Ticks start = Core::Clock::Now();
+        slot.handler(event);
+        LeaveHandler(slot);
+        RecordHandlerTime(slot, type, Core::Clock::ElapsedNanoseconds(start, Core::Clock::Now()));
+    }
+
+    void EventBus::RecordHandlerTime(SubscriptionSlot& slot, size_t type, uint64_t nanoseconds)
+    {
+        if (type < EventTypeCount) {
+            m_handlerTimeHistograms[type].Record(nanoseconds);
+        }
+        slot.callCount.fetch_add(1, std::memory_order_relaxed);
+        slot.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        uint64_t maxNanoseconds = slot.maxNanoseconds.load(std::memory_order_relaxed);
+        while (nanoseconds > maxNanoseconds && !slot.maxNanoseconds.compare_exchange_weak(maxNanoseconds, nanoseconds, std::memory_order_relaxed)) {
+        }
+    }
 } //namespace IneptEngine::Events
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <Events/EventBus.h>
+#include <Events/EventChannel.h>
+
+namespace IneptEngine::Events {
+
+    bool EventChannel::Create(const std::string& name)
+    {
+        Close();
+        if (!m_memory.Create(name, sizeof(Layout))) {
+            return false;
+        }
+
+        // The memory is zero filled, the rings are constructed in place before the other process may use them
+        Layout* layout = new (m_memory.GetData()) Layout();
+        std::memcpy(layout->magic, EventChannelMagic, sizeof(layout->magic));
+        layout->version = EventChannelVersion;
+        layout->recordSize = sizeof(EventChannelRecord);
+        layout->capacity = Capacity;
+        layout->ready.store(1, std::memory_order_release);
+
+        m_outgoing = &layout->rings[0];
+        m_incoming = &layout->rings[1];
+        return true;
+    }
+
+    bool EventChannel::Open(const std::string& name)
+    {
+        Close();
+        if (!m_memory.Open(name, sizeof(Layout))) {
+            return false;
+        }
+
+        Layout* layout = reinterpret_cast<Layout*>(m_memory.GetData());
+        if (layout->ready.load(std::memory_order_acquire) != 1 ||
+            std::memcmp(layout->magic, EventChannelMagic, sizeof(layout->magic)) != 0 || layout->version != EventChannelVersion ||
+            layout->recordSize != sizeof(EventChannelRecord) || layout->capacity != Capacity) {
+            m_memory.Close();
+            return false;
+        }
+
+        m_outgoing = &layout->rings[1];
+        m_incoming = &layout->rings[0];
+        return true;
+    }
+
+    void EventChannel::Close()
+    {
+        m_outgoing = nullptr;
+        m_incoming = nullptr;
+        m_memory.Close();
+    }
+
+    bool EventChannel::Send(const Event& event)
+    {
+        if (m_outgoing == nullptr) {
+            return false;
+        }
+
+        EventChannelRecord record = {};
+        record.type = static_cast<uint16_t>(event.GetType());
+        record.payloadSize = static_cast<uint16_t>(WriteEventPayload(event, record.payload));
+        record.timestamp = event.GetTimestamp();
+        if (!m_outgoing->TryPush(std::move(record))) {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    bool EventChannel::Receive(EventVariant& event)
+    {
+        if (m_incoming == nullptr) {
+            return false;
+        }
+
+        // Records that do not hold a readable event are skipped
+        EventChannelRecord record;
+        while (m_incoming->TryPop(record)) {
+            if (ReadEventPayload(static_cast<EventType>(record.type), record.payload, record.payloadSize, event)) {
+                GetEvent(event)->SetTimestamp(record.timestamp);
+                return true;
+            }
+        }
+        return false;
+    }
+} //namespace IneptEngine::Events
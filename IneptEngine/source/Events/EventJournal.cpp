@@ -0,0 +1,98 @@
+#include <Events/EventBus.h>
+#include <Events/EventJournal.h>
+
+#include <Logging/Log.h>
+
+namespace IneptEngine::Events {
+
+    bool EventJournalWriter::Open(const std::string& path)
+    {
+        m_recordCount = 0;
+        if (!m_file.OpenForWriting(path)) {
+            return false;
+        }
+
+        EventJournalHeader header;
+        std::memcpy(header.magic, EventJournalMagic, sizeof(header.magic));
+        header.version = EventJournalVersion;
+        return m_file.Append(&header, sizeof(header));
+    }
+
+    bool EventJournalWriter::Write(uint32_t frame, EventRecordKind kind, const Event& event)
+    {
+        // The header and payload are appended in one copy
+        std::byte record[sizeof(EventRecordHeader) + MaxEventPayloadSize];
+        size_t payloadSize = WriteEventPayload(event, record + sizeof(EventRecordHeader));
+
+        EventRecordHeader header{ frame, static_cast<uint16_t>(event.GetType()), static_cast<uint8_t>(payloadSize), static_cast<uint8_t>(kind) };
+        std::memcpy(record, &header, sizeof(header));
+
+        if (!m_file.Append(record, sizeof(EventRecordHeader) + payloadSize)) {
+            return false;
+        }
+        m_recordCount++;
+        return true;
+    }
+
+    bool EventJournalReader::Open(const std::string& path)
+    {
+        m_offset = 0;
+        if (!m_file.OpenForReading(path)) {
+            return false;
+        }
+
+        EventJournalHeader header;
+        if (m_file.GetSize() < sizeof(header)) {
+            m_file.Close();
+            return false;
+        }
+        std::memcpy(&header, m_file.GetData(), sizeof(header));
+        if (std::memcmp(header.magic, EventJournalMagic, sizeof(header.magic)) != 0 || header.version != EventJournalVersion) {
+            m_file.Close();
+            return false;
+        }
+
+        m_offset = sizeof(header);
+        return true;
+    }
+
+    void EventJournalReader::ReadFrame(uint32_t frame, std::vector<EventJournalRecord>& records)
+    {
+        const std::byte* data = m_file.GetData();
+        size_t size = m_file.GetSize();
+
+        while (m_offset + sizeof(EventRecordHeader) <= size) {
+            EventRecordHeader header;
+            std::memcpy(&header, data + m_offset, sizeof(header));
+
+            // A recording that was not closed still has the zero filled tail the file grew by, no event records as None
+            if (header.frame == 0 && header.type == 0 && header.payloadSize == 0 && header.kind == 0) {
+                m_offset = size;
+                return;
+            }
+            if (header.frame > frame) {
+                return;
+            }
+
+            size_t payloadOffset = m_offset + sizeof(EventRecordHeader);
+            if (payloadOffset + header.payloadSize > size) {
+                LOG_WARNING("Event journal ends in the middle of a record");
+                m_offset = size;
+                return;
+            }
+            m_offset = payloadOffset + header.payloadSize;
+
+            EventVariant event;
+            if (header.kind > static_cast<uint8_t>(EventRecordKind::Timer)) {
+                LOG_WARNING("Skipping event journal record of unknown kind {}", header.kind);
+            }
+            else if (ReadEventPayload(static_cast<EventType>(header.type), data + payloadOffset, header.payloadSize, event)) {
+                records.push_back({ static_cast<EventRecordKind>(header.kind), std::move(event) });
+            }
+            else {
+                LOG_WARNING("Skipping unreadable event journal record of type {}", header.type);
+            }
+        }
+        m_offset = size;
+    }
+} //namespace IneptEngine::Events
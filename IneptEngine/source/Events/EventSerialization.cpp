@@ -0,0 +1,226 @@
+#include <Events/EventBus.h>
+#include <Events/EventSerialization.h>
+
+namespace IneptEngine::Events {
+
+    namespace {
+        // Fields are stored as consecutive 32-bit values
+        class PayloadWriter {
+        public:
+            explicit PayloadWriter(std::byte* payload) : m_payload(payload) {}
+
+            template<typename T>
+            PayloadWriter& Write(T value) {
+                static_assert(sizeof(T) == 4, "Payload fields are 32 bits");
+                std::memcpy(m_payload + m_size, &value, sizeof(T));
+                m_size += sizeof(T);
+                return *this;
+            }
+
+            size_t GetSize() const { return m_size; }
+
+        private:
+            std::byte* m_payload;
+            size_t m_size = 0;
+        };
+
+        class PayloadReader {
+        public:
+            explicit PayloadReader(const std::byte* payload) : m_payload(payload) {}
+
+            template<typename T>
+            T Read() {
+                static_assert(sizeof(T) == 4, "Payload fields are 32 bits");
+                T value;
+                std::memcpy(&value, m_payload + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return value;
+            }
+
+        private:
+            const std::byte* m_payload;
+            size_t m_offset = 0;
+        };
+
+        /**
+         * @brief Number of payload bytes written for each event type
+         */
+        size_t GetPayloadSize(EventType type) {
+            switch (type) {
+            case EventType::WindowResize:
+            case EventType::WindowMoved:
+            case EventType::KeyPressed:
+            case EventType::KeyReleased:
+            case EventType::KeyTyped:
+            case EventType::MouseMoved:
+            case EventType::MouseScrolled:
+                return 8;
+            case EventType::KeyHeld:
+            case EventType::KeyRepeated:
+            case EventType::MouseButtonPressed:
+            case EventType::MouseButtonReleased:
+                return 12;
+            default:
+                return 0;
+            }
+        }
+    }
+
+    size_t WriteEventPayload(const Event& event, std::byte* payload)
+    {
+        PayloadWriter writer(payload);
+        switch (event.GetType()) {
+        case EventType::WindowResize: {
+            const auto& resize = static_cast<const WindowResizeEvent&>(event);
+            writer.Write<int32_t>(resize.GetWidth()).Write<int32_t>(resize.GetHeight());
+            break;
+        }
+        case EventType::WindowMoved: {
+            const auto& moved = static_cast<const WindowMovedEvent&>(event);
+            writer.Write<int32_t>(moved.GetX()).Write<int32_t>(moved.GetY());
+            break;
+        }
+        case EventType::KeyPressed:
+        case EventType::KeyReleased:
+        case EventType::KeyTyped: {
+            const auto& key = static_cast<const KeyEvent&>(event);
+            writer.Write<int32_t>(key.GetKey()).Write<int32_t>(static_cast<int32_t>(key.GetMods()));
+            break;
+        }
+        case EventType::KeyHeld: {
+            const auto& held = static_cast<const KeyHeldEvent&>(event);
+            writer.Write<int32_t>(held.GetKey()).Write<int32_t>(static_cast<int32_t>(held.GetMods())).Write<float>(held.GetDuration());
+            break;
+        }
+        case EventType::KeyRepeated: {
+            const auto& repeated = static_cast<const KeyRepeatedEvent&>(event);
+            writer.Write<int32_t>(repeated.GetKey()).Write<int32_t>(static_cast<int32_t>(repeated.GetMods())).Write<int32_t>(repeated.GetRepeatCount());
+            break;
+        }
+        case EventType::MouseButtonPressed: {
+            const auto& pressed = static_cast<const MouseButtonPressedEvent&>(event);
+            writer.Write<int32_t>(pressed.GetButton()).Write<float>(pressed.GetX()).Write<float>(pressed.GetY());
+            break;
+        }
+        case EventType::MouseButtonReleased: {
+            const auto& released = static_cast<const MouseButtonReleasedEvent&>(event);
+            writer.Write<int32_t>(released.GetButton()).Write<float>(released.GetX()).Write<float>(released.GetY());
+            break;
+        }
+        case EventType::MouseMoved:
+        case EventType::MouseScrolled: {
+            const auto& mouse = static_cast<const MouseEvent&>(event);
+            writer.Write<float>(mouse.GetX()).Write<float>(mouse.GetY());
+            break;
+        }
+        default:
+            break;
+        }
+        return writer.GetSize();
+    }
+
+    bool ReadEventPayload(EventType type, const std::byte* payload, size_t payloadSize, EventVariant& event)
+    {
+        if (type == EventType::None || static_cast<size_t>(type) > std::variant_size_v<EventVariant> || payloadSize != GetPayloadSize(type)) {
+            return false;
+        }
+
+        PayloadReader reader(payload);
+        switch (type) {
+        case EventType::WindowClose:
+            event.emplace<WindowCloseEvent>();
+            break;
+        case EventType::WindowResize: {
+            int32_t width = reader.Read<int32_t>();
+            int32_t height = reader.Read<int32_t>();
+            event.emplace<WindowResizeEvent>(width, height);
+            break;
+        }
+        case EventType::WindowFocus:
+            event.emplace<WindowFocusEvent>();
+            break;
+        case EventType::WindowLostFocus:
+            event.emplace<WindowLostFocusEvent>();
+            break;
+        case EventType::WindowMoved: {
+            int32_t x = reader.Read<int32_t>();
+            int32_t y = reader.Read<int32_t>();
+            event.emplace<WindowMovedEvent>(x, y);
+            break;
+        }
+        case EventType::WindowMinimized:
+            event.emplace<WindowMinimizedEvent>();
+            break;
+        case EventType::WindowRestored:
+            event.emplace<WindowRestoredEvent>();
+            break;
+        case EventType::AppTick:
+            event.emplace<AppTickEvent>();
+            break;
+        case EventType::AppUpdate:
+            event.emplace<AppUpdateEvent>();
+            break;
+        case EventType::AppRender:
+            event.emplace<AppRenderEvent>();
+            break;
+        case EventType::KeyPressed:
+        case EventType::KeyReleased:
+        case EventType::KeyTyped: {
+            auto key = static_cast<Keyboard::Key>(reader.Read<int32_t>());
+            auto mods = static_cast<Keyboard::KeyModifier>(reader.Read<int32_t>());
+            if (type == EventType::KeyPressed) {
+                event.emplace<KeyPressedEvent>(key, mods);
+            }
+            else if (type == EventType::KeyReleased) {
+                event.emplace<KeyReleasedEvent>(key, mods);
+            }
+            else {
+                event.emplace<KeyTypedEvent>(key, mods);
+            }
+            break;
+        }
+        case EventType::KeyHeld: {
+            auto key = static_cast<Keyboard::Key>(reader.Read<int32_t>());
+            auto mods = static_cast<Keyboard::KeyModifier>(reader.Read<int32_t>());
+            float duration = reader.Read<float>();
+            event.emplace<KeyHeldEvent>(key, mods, duration);
+            break;
+        }
+        case EventType::KeyRepeated: {
+            auto key = static_cast<Keyboard::Key>(reader.Read<int32_t>());
+            auto mods = static_cast<Keyboard::KeyModifier>(reader.Read<int32_t>());
+            int32_t repeatCount = reader.Read<int32_t>();
+            event.emplace<KeyRepeatedEvent>(key, mods, repeatCount);
+            break;
+        }
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased: {
+            auto button = static_cast<Input::MouseButton>(reader.Read<int32_t>());
+            float x = reader.Read<float>();
+            float y = reader.Read<float>();
+            if (type == EventType::MouseButtonPressed) {
+                event.emplace<MouseButtonPressedEvent>(button, x, y);
+            }
+            else {
+                event.emplace<MouseButtonReleasedEvent>(button, x, y);
+            }
+            break;
+        }
+        case EventType::MouseMoved:
+        case EventType::MouseScrolled: {
+            float x = reader.Read<float>();
+            float y = reader.Read<float>();
+            if (type == EventType::MouseMoved) {
+                event.emplace<MouseMovedEvent>(x, y);
+            }
+            else {
+                event.emplace<MouseScrolledEvent>(x, y);
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+        return true;
+    }
+} //namespace IneptEngine::Events
@@ -0,0 +1,13 @@
+#include <Events/Subscription.h>
+
+#include <Events/EventBus.h>
+
+namespace IneptEngine::Events {
+    void SubscriptionToken::Reset()
+    {
+        if (IsValid()) {
+            EventBus::GetInstance().Unsubscribe(m_handle);
+            m_handle = SubscriptionHandle();
+        }
+    }
+} //namespace IneptEngine::Events
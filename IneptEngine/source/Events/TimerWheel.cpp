@@ -0,0 +1,154 @@
+#include <Events/EventBus.h>
+
+#include <Events/TimerWheel.h>
+
+namespace IneptEngine::Events {
+
+    TimerHandle TimerWheel::Schedule(uint64_t dueTick, uint64_t period, EventVariant event)
+    {
+        uint32_t index;
+        if (!m_freeTimers.empty()) {
+            index = m_freeTimers.back();
+            m_freeTimers.pop_back();
+        }
+        else {
+            index = static_cast<uint32_t>(m_timers.size());
+            m_timers.emplace_back();
+        }
+
+        Timer& timer = m_timers[index];
+        timer.dueTick = (std::max)(dueTick, m_currentTick);
+        timer.period = period;
+        timer.pending = true;
+        timer.event = std::move(event);
+        Link(index);
+        m_pendingCount++;
+        return { index, timer.generation };
+    }
+
+    bool TimerWheel::Cancel(TimerHandle handle)
+    {
+        if (!IsPending(handle)) {
+            return false;
+        }
+
+        Unlink(handle.index);
+        Free(handle.index);
+        return true;
+    }
+
+    void TimerWheel::Advance(uint64_t tick, std::vector<EventVariant>& firedEvents)
+    {
+        while (m_currentTick <= tick) {
+            // Without pending timers there is nothing to cascade, so the wheels can jump ahead
+            if (m_pendingCount == 0) {
+                m_currentTick = tick + 1;
+                return;
+            }
+
+            // When the first wheel wraps, the next slot of the wheel above is moved down, and so on for every wheel that wraps with it
+            uint32_t slot = static_cast<uint32_t>(m_currentTick & SlotMask);
+            if (slot == 0) {
+                for (uint32_t level = 1; level < LevelCount; level++) {
+                    uint32_t levelSlot = static_cast<uint32_t>((m_currentTick >> (level * SlotBits)) & SlotMask);
+                    Cascade(level, levelSlot);
+                    if (levelSlot != 0) {
+                        break;
+                    }
+                }
+            }
+
+            // Periodic timers are linked again while the list is walked, so the list is detached first
+            uint32_t index = TakeList(slot);
+            while (index != InvalidIndex) {
+                Timer& timer = m_timers[index];
+                uint32_t next = timer.next;
+                timer.list = InvalidIndex;
+                if (timer.period != 0) {
+                    firedEvents.push_back(timer.event);
+                    timer.dueTick += timer.period;
+                    Link(index);
+                }
+                else {
+                    firedEvents.push_back(std::move(timer.event));
+                    Free(index);
+                }
+                index = next;
+            }
+            m_currentTick++;
+        }
+    }
+
+    void TimerWheel::Link(uint32_t index)
+    {
+        Timer& timer = m_timers[index];
+        uint64_t delta = timer.dueTick - m_currentTick;
+        uint64_t placedTick = delta < MaxDelta ? timer.dueTick : m_currentTick + MaxDelta - 1;
+
+        // The wheel is picked by how far away the timer is, the slot by the bits of its tick that wheel is indexed by
+        uint32_t level = 0;
+        while (level + 1 < LevelCount && (placedTick - m_currentTick) >= (uint64_t(1) << (SlotBits * (level + 1)))) {
+            level++;
+        }
+        uint32_t list = level * SlotCount + static_cast<uint32_t>((placedTick >> (level * SlotBits)) & SlotMask);
+
+        timer.list = list;
+        timer.next = InvalidIndex;
+        timer.previous = m_tails[list];
+        if (m_tails[list] != InvalidIndex) {
+            m_timers[m_tails[list]].next = index;
+        }
+        else {
+            m_heads[list] = index;
+        }
+        m_tails[list] = index;
+    }
+
+    void TimerWheel::Unlink(uint32_t index)
+    {
+        Timer& timer = m_timers[index];
+        if (timer.previous != InvalidIndex) {
+            m_timers[timer.previous].next = timer.next;
+        }
+        else {
+            m_heads[timer.list] = timer.next;
+        }
+        if (timer.next != InvalidIndex) {
+            m_timers[timer.next].previous = timer.previous;
+        }
+        else {
+            m_tails[timer.list] = timer.previous;
+        }
+        timer.list = InvalidIndex;
+        timer.previous = InvalidIndex;
+        timer.next = InvalidIndex;
+    }
+
+    uint32_t TimerWheel::TakeList(uint32_t list)
+    {
+        uint32_t head = m_heads[list];
+        m_heads[list] = InvalidIndex;
+        m_tails[list] = InvalidIndex;
+        return head;
+    }
+
+    void TimerWheel::Cascade(uint32_t level, uint32_t slot)
+    {
+        uint32_t index = TakeList(level * SlotCount + slot);
+        while (index != InvalidIndex) {
+            uint32_t next = m_timers[index].next;
+            Link(index);
+            index = next;
+        }
+    }
+
+    void TimerWheel::Free(uint32_t index)
+    {
+        Timer& timer = m_timers[index];
+        timer.pending = false;
+        timer.generation++;
+        timer.event = EventVariant();
+        m_freeTimers.push_back(index);
+        m_pendingCount--;
+    }
+} //namespace IneptEngine::Events
@@ -174,8 +174,25 @@ namespace IneptEngine::Input {
         case WM_SIZE: {
             // Publish the event to the event buffer
             EVENT_PUBLISH(WindowResizeEvent,m_Window->GetWidth(),m_Window->GetHeight());
+
+            // Every minimize and restore arrives here, from the taskbar or from Window::Minimize and Restore, the
+            // application throttles while minimized
+            if (wParam == SIZE_MINIMIZED && !m_minimized) {
+                m_minimized = true;
+                EVENT_PUBLISH(WindowMinimizedEvent);
+            }
+            else if ((wParam == SIZE_RESTORED || wParam == SIZE_MAXIMIZED) && m_minimized) {
+                m_minimized = false;
+                EVENT_PUBLISH(WindowRestoredEvent);
+            }
         }
         break;
+        case WM_SETFOCUS:
+            EVENT_PUBLISH(WindowFocusEvent);
+            break;
+        case WM_KILLFOCUS:
+            EVENT_PUBLISH(WindowLostFocusEvent);
+            break;
         case WM_DESTROY:
             PostQuitMessage(0);
             break;
@@ -198,6 +215,12 @@ namespace IneptEngine::Input {
         }
     }
 
+    void WindowsInput::WaitForEvents(std::chrono::milliseconds timeout)
+    {
+        // Returns as soon as any message is posted to the thread, without removing it from the queue
+        MsgWaitForMultipleObjects(0, nullptr, FALSE, static_cast<DWORD>(timeout.count()), QS_ALLINPUT);
+    }
+
     void WindowsInput::SetWindow(WindowsWindow* window)
     {
         m_Window = window;
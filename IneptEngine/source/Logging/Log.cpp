@@ -1,5 +1,7 @@
 #include <Logging/Log.h>
 
+#include <Core/Clock.h>
+
 namespace IneptEngine::Logging
 {
 	std::ostream* Log::output = &std::cout; // default output stream is std::cout
@@ -14,7 +16,8 @@ namespace IneptEngine::Logging
 		Log::output = &output;
 	}
 
-	void Log::logMessage(LogLevel level, const std::string& message, bool isVerbose, std::string func, std::string file, int line) {
+	void Log::logMessage(LogLevel level, std::string_view message, bool isVerbose, const char* func, const char* file, int line) {
+		Core::Clock::Ticks timestamp = Core::Clock::Now();
 		LogColor color;
 		switch (level) {
 		case LogLevel::LOGERROR:
@@ -36,12 +39,12 @@ namespace IneptEngine::Logging
 			color = LogColor::DEFAULT;
 			break;
 		}
-		std::string msg = message;
+		*output << toColorCode(color) << "[" << Core::Clock::FormatTime(timestamp) << "] [" + toString(level) + "]";
+		*output << " " << message;
 		if (isVerbose) {
-			msg = std::format("{} |Function: {} File: {} Line: {}|", message, func, file, line);
+			*output << std::format(" |Function: {} File: {} Line: {}|", func, file, line);
 		}
-		*output << toColorCode(color) << "[" + toString(level) + "]"; //Date&Time : "[" << std::format("{:%T}", std::chrono::system_clock::now()) << "] - " << 
-		*output << " " << msg << toColorCode(color) << "\n"; //Color: << toColorCode(DEFAULT) 
+		*output << toColorCode(color) << "\n"; //Color: << toColorCode(DEFAULT) 
 	}
 
 	void Log::logMessageEx(const std::string& message, LogLevel level, LogColor color) {
@@ -7,8 +7,8 @@ namespace IneptEngine::Rendering
     OpenGLContext::OpenGLContext(IneptEngine::Windowing::Window* window) : Context(window) {
         // Create platform-specific window handle and device context/display
 #ifdef INEPT_PLATFORM_WINDOWS
-        m_Window = static_cast<IneptEngine::Windowing::WindowsWindow*>(window);
-        m_DeviceContext = GetDC(m_Window->GetHandle());
+        m_WindowHandle = static_cast<IneptEngine::Windowing::WindowsWindow*>(window)->GetHandle();
+        m_DeviceContext = GetDC(m_WindowHandle);
         PIXELFORMATDESCRIPTOR pfd;
         ZeroMemory(&pfd, sizeof(pfd));
         pfd.nSize = sizeof(pfd);
@@ -47,6 +47,17 @@ namespace IneptEngine::Rendering
 #endif
     }
 
+    OpenGLContext::~OpenGLContext() {
+#ifdef INEPT_PLATFORM_WINDOWS
+        if (m_OpenGLContext != nullptr)
+        {
+            wglMakeCurrent(nullptr, nullptr);
+            wglDeleteContext(static_cast<HGLRC>(m_OpenGLContext));
+        }
+        ReleaseDC(m_WindowHandle, static_cast<HDC>(m_DeviceContext));
+#endif
+    }
+
     void OpenGLContext::Init() {
         // Initialize GLAD
         if (!gladLoadGL())
@@ -56,18 +67,27 @@ namespace IneptEngine::Rendering
     }
 
     void OpenGLContext::MakeCurrent() {
+#ifdef INEPT_PLATFORM_WINDOWS
         if (!wglMakeCurrent(static_cast<HDC>(m_DeviceContext), static_cast<HGLRC>(m_OpenGLContext)))
         {
             LOG_ERROR("Failed to make the rendering context current");
         }
+#endif
+    }
+
+    void OpenGLContext::ReleaseCurrent() {
+#ifdef INEPT_PLATFORM_WINDOWS
+        if (!wglMakeCurrent(nullptr, nullptr))
+        {
+            LOG_ERROR("Failed to release the rendering context");
+        }
+#endif
     }
 
     void OpenGLContext::SwapBuffers() {
         // Swap buffers for double buffering
 #ifdef INEPT_PLATFORM_WINDOWS
         ::SwapBuffers(static_cast<HDC>(m_DeviceContext));
-#elif INEPT_PLATFORM_LINUX
-        glXSwapBuffers(static_cast<Display*>(m_Display), static_cast<Window>(m_Window));
 #elif INEPT_PLATFORM_MACOS
         [[NSOpenGLContext currentContext]flushBuffer];
 #endif
@@ -3,29 +3,43 @@
 namespace IneptEngine::Rendering {
 	OpenGLRenderer::~OpenGLRenderer()
 	{
+		// The render thread draws through this renderer, it has to stop before the renderer is gone
+		SetPipelined(false);
+		delete square;
 	}
 
-	void OpenGLRenderer::Render()
+	void OpenGLRenderer::PrepareFrame(RenderFrame& frame)
 	{
-		// Clear the screen and draw your scene
-		m_context->MakeCurrent();
+		frame.viewMatrix = camera.GetViewMatrix();
+		frame.projectionMatrix = camera.GetProjectionMatrix();
+		frame.viewportWidth = m_viewportWidth;
+		frame.viewportHeight = m_viewportHeight;
+	}
+
+	void OpenGLRenderer::DrawFrame(RenderFrame& frame)
+	{
+		PROFILE_SCOPE("OpenGLRenderer::DrawFrame");
 
+		// The context is current on the calling thread, the main thread or the render thread when pipelined
+		if (frame.viewportWidth != 0 && (frame.viewportWidth != m_drawnViewportWidth || frame.viewportHeight != m_drawnViewportHeight)) {
+			glViewport(0, 0, frame.viewportWidth, frame.viewportHeight);
+			m_drawnViewportWidth = frame.viewportWidth;
+			m_drawnViewportHeight = frame.viewportHeight;
+		}
+
+		// Clear the screen and draw your scene
 		glClearColor(0, 0, 0, 1);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
-		//
-		glm::mat4 viewMatrix = camera.GetViewMatrix();
-		glm::mat4 projectionMatrix = camera.GetProjectionMatrix();
-		//
-		
 		// Pass the matrices to the shader program
-		square->GetShader()->SetUniform("viewMatrix", viewMatrix);
-		square->GetShader()->SetUniform("projectionMatrix", projectionMatrix);
+		square->GetShader()->SetUniform("viewMatrix", frame.viewMatrix);
+		square->GetShader()->SetUniform("projectionMatrix", frame.projectionMatrix);
 
 		// Draw here
 		square->Render();
+		frame.ExecuteCommands();
 		//
 
 		m_context->SwapBuffers();
 	}
-}
\ No newline at end of file
+}
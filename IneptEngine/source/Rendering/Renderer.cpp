@@ -1,12 +1,112 @@
 #include <Rendering/Renderer.h>
 #include <Rendering/OpenGL/OpenGLRenderer.h>
+#include <Rendering/Null/NullRenderer.h>
+#include <Core/Profiler.h>
 
 namespace IneptEngine::Rendering {
 	Renderer* Renderer::CreateRenderer(IneptEngine::Windowing::Window* window,RenderingAPI api) {
+		MEMORY_TAG_SCOPE(Rendering);
 		if (api == RenderingAPI::OpenGL)
 		{
 			return new OpenGLRenderer(window);
+		}
+		else if (api == RenderingAPI::Null)
+		{
+			return new NullRenderer(window);
 		} else
 		return nullptr;
 	}
-}
\ No newline at end of file
+
+	Renderer::~Renderer()
+	{
+		SetPipelined(false);
+		delete m_context;
+	}
+
+	void Renderer::Render()
+	{
+		PROFILE_SCOPE("Renderer::Render");
+		MEMORY_TAG_SCOPE(Rendering);
+
+		RenderFrame& frame = m_frames[m_recordIndex];
+		frame.index = m_frameIndex++;
+		PrepareFrame(frame);
+
+		if (!m_renderThread.joinable()) {
+			DrawFrame(frame);
+			frame.Clear();
+			return;
+		}
+
+		{
+			// The render thread is done with the previous frame once it is no longer pending, so the other buffer is free
+			std::unique_lock<std::mutex> lock(m_renderMutex);
+			PROFILE_SCOPE("Renderer::WaitForRenderThread");
+			m_frameDone.wait(lock, [this]() { return m_pendingFrame == nullptr; });
+			m_pendingFrame = &frame;
+		}
+		m_frameReady.notify_one();
+		m_recordIndex ^= 1;
+	}
+
+	void Renderer::SetPipelined(bool pipelined)
+	{
+		if (pipelined == m_renderThread.joinable()) {
+			return;
+		}
+
+		if (pipelined) {
+			// A context is current on one thread at a time, the render thread takes it over
+			if (m_context != nullptr) {
+				m_context->ReleaseCurrent();
+			}
+			m_stopRendering = false;
+			m_renderThread = std::thread([this]() { RenderLoop(); });
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_renderMutex);
+			m_stopRendering = true;
+		}
+		m_frameReady.notify_one();
+		m_renderThread.join();
+		if (m_context != nullptr) {
+			m_context->MakeCurrent();
+		}
+	}
+
+	void Renderer::RenderLoop()
+	{
+		Core::Profiler::SetThreadName("Render thread");
+		MEMORY_TAG_SCOPE(Rendering);
+		if (m_context != nullptr) {
+			m_context->MakeCurrent();
+		}
+
+		for (;;) {
+			RenderFrame* frame;
+			{
+				std::unique_lock<std::mutex> lock(m_renderMutex);
+				m_frameReady.wait(lock, [this]() { return m_pendingFrame != nullptr || m_stopRendering; });
+				if (m_pendingFrame == nullptr) {
+					break;
+				}
+				frame = m_pendingFrame;
+			}
+
+			DrawFrame(*frame);
+			frame->Clear();
+
+			{
+				std::lock_guard<std::mutex> lock(m_renderMutex);
+				m_pendingFrame = nullptr;
+			}
+			m_frameDone.notify_one();
+		}
+
+		if (m_context != nullptr) {
+			m_context->ReleaseCurrent();
+		}
+	}
+}
@@ -0,0 +1,193 @@
+#include <IneptEngine.h>
+
+#include <Windowing/Headless/HeadlessWindow.h>
+#include <Input/Headless/HeadlessInput.h>
+
+namespace IneptEngine::Windowing
+{
+    HeadlessWindow::HeadlessWindow(Window* parent, int width, int height, const std::string title)
+    {
+        m_inputManager = new HeadlessInput();
+
+        Create(parent, width, height, title);
+        this->Show();
+    }
+
+    HeadlessWindow::~HeadlessWindow()
+    {
+        if (m_parent != nullptr)
+            m_parent->RemoveChild(this);
+        RemoveAllChildren();
+    }
+
+    void HeadlessWindow::Create(Window* parent, int width, int height, const std::string title)
+    {
+        m_title = title;
+        m_width = width;
+        m_height = height;
+
+        LOG_INFO("New headless window [{0}] [width:{1},height:{2}] created", this->GetTitle(), width, height);
+        if (parent != nullptr)
+            parent->AddChild(this);
+    }
+
+    void HeadlessWindow::Update()
+    {
+        PROFILE_SCOPE("HeadlessWindow::Update");
+        {
+            MEMORY_TAG_SCOPE(Input);
+            m_inputManager->PollEvents();
+        }
+        if (m_renderer != nullptr) {
+            m_renderer->Render();
+        }
+    }
+
+    void HeadlessWindow::Close()
+    {
+        // There is no OS to ask, closing ends the application the same way closing a real window does
+        m_visible = false;
+        EVENT_PUBLISH(WindowCloseEvent);
+    }
+
+    void HeadlessWindow::Show()
+    {
+        m_visible = true;
+    }
+
+    void HeadlessWindow::Hide()
+    {
+        m_visible = false;
+    }
+
+    bool HeadlessWindow::IsVisible()
+    {
+        return m_visible;
+    }
+
+    void HeadlessWindow::Move(int x, int y)
+    {
+        SetPosition(x, y);
+    }
+
+    void HeadlessWindow::Resize(int width, int height)
+    {
+        SetSize(width, height);
+    }
+
+    bool HeadlessWindow::IsMaximized()
+    {
+        return m_maximized;
+    }
+
+    bool HeadlessWindow::IsMinimized()
+    {
+        return m_minimized;
+    }
+
+    void HeadlessWindow::Minimize()
+    {
+        if (!m_minimized) {
+            m_minimized = true;
+            EVENT_PUBLISH(WindowMinimizedEvent);
+        }
+    }
+
+    void HeadlessWindow::Maximize()
+    {
+        m_maximized = true;
+        Restore();
+    }
+
+    void HeadlessWindow::Restore()
+    {
+        if (m_minimized) {
+            m_minimized = false;
+            EVENT_PUBLISH(WindowRestoredEvent);
+        }
+    }
+
+    void HeadlessWindow::ShowFullScreen()
+    {
+        m_fullscreen = true;
+    }
+
+    void HeadlessWindow::CloseFullScreen()
+    {
+        m_fullscreen = false;
+    }
+
+    void HeadlessWindow::SetFullscreen(bool fullscreen)
+    {
+        m_fullscreen = fullscreen;
+    }
+
+    bool HeadlessWindow::IsFocused()
+    {
+        return true;
+    }
+
+    void HeadlessWindow::SetTitle(const std::string title)
+    {
+        m_title = title;
+    }
+
+    const std::string HeadlessWindow::GetTitle()
+    {
+        return m_title;
+    }
+
+    void HeadlessWindow::SetPosition(int x, int y)
+    {
+        m_x = x;
+        m_y = y;
+        EVENT_PUBLISH(WindowMovedEvent, x, y);
+    }
+
+    void HeadlessWindow::SetSize(int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+        EVENT_PUBLISH(WindowResizeEvent, width, height);
+    }
+
+    int HeadlessWindow::GetWidth()
+    {
+        return m_width;
+    }
+
+    int HeadlessWindow::GetHeight()
+    {
+        return m_height;
+    }
+
+    void HeadlessWindow::AddChild(Window* child)
+    {
+        m_children.push_back(child);
+        child->SetParentWindow(this);
+    }
+
+    void HeadlessWindow::RemoveChild(Window* child)
+    {
+        std::erase(m_children, child);
+        child->SetParentWindow(nullptr);
+    }
+
+    void HeadlessWindow::RemoveAllChildren()
+    {
+        for (Window* child : m_children) {
+            child->SetParentWindow(nullptr);
+        }
+        m_children.clear();
+    }
+
+    Window* HeadlessWindow::GetParentWindow()
+    {
+        return m_parent;
+    }
+
+    void HeadlessWindow::SetParentWindow(Window* parent)
+    {
+        m_parent = parent;
+    }
+} // namespace IneptEngine::Windowing
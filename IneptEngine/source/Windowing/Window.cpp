@@ -1,4 +1,6 @@
 #include <Windowing/Window.h>
+#include <Windowing/Headless/HeadlessWindow.h>
+#include <Core/MemoryTracker.h>
 
 #ifdef INEPT_PLATFORM_WINDOWS
 #include <Windowing/Windows/WindowsWindow.h> 
@@ -7,10 +9,17 @@
 namespace IneptEngine::Windowing {
     Window* Window::CreateIneptWindow(Window* parent, int width, int height, const std::string title)
     {
+        MEMORY_TAG_SCOPE(Windowing);
 #ifdef INEPT_PLATFORM_WINDOWS
         return new WindowsWindow(parent, width, height, title);
 #else
         return nullptr;
 #endif
     }
+
+    Window* Window::CreateHeadlessWindow(Window* parent, int width, int height, const std::string title)
+    {
+        MEMORY_TAG_SCOPE(Windowing);
+        return new HeadlessWindow(parent, width, height, title);
+    }
 }
\ No newline at end of file
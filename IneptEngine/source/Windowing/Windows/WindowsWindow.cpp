@@ -28,6 +28,9 @@ namespace IneptEngine::Windowing
 
     WindowsWindow::~WindowsWindow()
     {
+        // The renderer frees its GL objects and context through this window, it goes before the window is destroyed
+        delete m_renderer;
+        m_renderer = nullptr;
         Close();
     }
 
@@ -74,7 +77,11 @@ namespace IneptEngine::Windowing
 
     void WindowsWindow::Update()
     {
-        m_inputManager->PollEvents();
+        PROFILE_SCOPE("WindowsWindow::Update");
+        {
+            MEMORY_TAG_SCOPE(Input);
+            m_inputManager->PollEvents();
+        }
         if (m_renderer != nullptr) {
             m_renderer->Render();
         }
@@ -157,7 +164,6 @@ namespace IneptEngine::Windowing
         // Use the Windows API to minimize the window
         if (ShowWindow(m_handle, SW_MINIMIZE)) {
             LOG_INFO("Minimizing window [{0}]", this->GetTitle());
-            EVENT_PUBLISH(WindowMinimizedEvent);
         }
         else
             LOG_ERROR("Minimizing window [{0}] failed!", this->GetTitle());
@@ -168,8 +174,6 @@ namespace IneptEngine::Windowing
         // Use the Windows API to maximize the window
         if (ShowWindow(m_handle, SW_MAXIMIZE)) {
             LOG_INFO("Maximizing window [{0}]", this->GetTitle());
-
-            EVENT_PUBLISH(WindowRestoredEvent);
         }
         else
             LOG_ERROR("Maximizing window [{0}] failed!", this->GetTitle());
@@ -180,8 +184,6 @@ namespace IneptEngine::Windowing
         // Use the Windows API to restore the window
         if (ShowWindow(m_handle, SW_RESTORE)) {
             LOG_INFO("Restoring window [{0}]", this->GetTitle());
-
-            EVENT_PUBLISH(WindowRestoredEvent);
         }
         else
             LOG_ERROR("Restoring window [{0}] failed!", this->GetTitle());
@@ -193,8 +195,6 @@ namespace IneptEngine::Windowing
         SetWindowLongPtr(m_handle, GWL_STYLE, WS_POPUP | WS_VISIBLE);
         if (SetWindowPos(m_handle, HWND_TOP, 0, 0, GetSystemMetrics(SM_CXSCREEN), GetSystemMetrics(SM_CYSCREEN), SWP_SHOWWINDOW)) {
             LOG_INFO("Showing window [{0}] fullscreen", this->GetTitle());
-
-            EVENT_PUBLISH(WindowRestoredEvent);
         }
         else
             LOG_ERROR("Showing window [{0}] fullscreen failed!", this->GetTitle());